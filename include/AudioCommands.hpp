@@ -0,0 +1,46 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+
+namespace PlayAsGobo {
+
+// Process-wide front end for raylib audio, which is itself process-wide.
+// Every raylib audio call takes the mixer's lock, so the game thread only
+// pushes commands into a single-producer/single-consumer ring; a dedicated
+// audio thread drains it, makes the raylib calls, streams music and
+// publishes playback status through atomics. The game thread never waits
+// on the mixer.
+//
+// The game thread is the only producer. Sounds and music must stay loaded
+// until Stop() has returned.
+namespace AudioCommands {
+
+// Start() once the audio device and assets are up; Stop() runs whatever is
+// still queued, then joins the thread. Until Start() (and after Stop())
+// commands run directly on the calling thread.
+void Start();
+void Stop() noexcept;
+[[nodiscard]] bool IsRunning() noexcept;
+
+// Never block; when the ring is full the command is dropped and counted
+void PlaySound(const Sound& sound) noexcept;
+void StopSound(const Sound& sound) noexcept;
+void SetSoundVolume(const Sound& sound, float volume) noexcept;
+void SetSoundPan(const Sound& sound, float pan) noexcept;
+void PlayMusic(const Music& music) noexcept; // The audio thread keeps it streaming until StopMusic
+void StopMusic(const Music& music) noexcept;
+void PauseMusic(const Music& music) noexcept;
+void ResumeMusic(const Music& music) noexcept;
+void SetMusicVolume(const Music& music, float volume) noexcept;
+
+// Status as last published by the audio thread. While commands are still
+// queued the answer is true, so a sound that was just asked for never reads
+// as finished before it started.
+[[nodiscard]] bool IsSoundPlaying(const Sound& sound) noexcept;
+[[nodiscard]] bool IsMusicPlaying(const Music& music) noexcept;
+[[nodiscard]] std::uint64_t GetDroppedCommandCount() noexcept;
+
+} // namespace AudioCommands
+
+} // namespace PlayAsGobo
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Per-enemy values a behaviour script reads (read-only)
+enum class BehaviourInput : std::uint8_t {
+    X,
+    Y,
+    Radius,
+    OnGround, // 1 or 0
+    Facing,   // 1 right, -1 left
+    Count
+};
+
+// Values shared by every enemy in a tick (read-only)
+enum class BehaviourUniform : std::uint8_t {
+    DeltaTime,
+    PlayerX,
+    PlayerY,
+    FinishX,
+    MapWidth,
+    GroundY,
+    Count
+};
+
+// Decisions a script writes; anything not written reads back as 0
+enum class BehaviourOutput : std::uint8_t {
+    Move,      // -1..1, fraction of the enemy's speed; the sign sets the facing
+    Jump,      // Non-zero jumps when on the ground
+    Throw,     // Non-zero lobs a projectile at Gobo
+    Fly,       // Non-zero replaces gravity with VelocityY this tick
+    VelocityY,
+    Count
+};
+
+inline constexpr std::size_t BEHAVIOUR_INPUT_COUNT = static_cast<std::size_t>(BehaviourInput::Count);
+inline constexpr std::size_t BEHAVIOUR_UNIFORM_COUNT = static_cast<std::size_t>(BehaviourUniform::Count);
+inline constexpr std::size_t BEHAVIOUR_OUTPUT_COUNT = static_cast<std::size_t>(BehaviourOutput::Count);
+inline constexpr std::size_t BEHAVIOUR_MEMORY_COUNT = 4; // m0..m3, kept per enemy between ticks
+
+enum class BehaviourOpcode : std::uint8_t {
+    Copy,
+    Add,
+    Subtract,
+    Multiply,
+    Divide, // x / 0 is 0, so scripts can't produce inf or NaN
+    Minimum,
+    Maximum,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    And,
+    Or,
+    Not,
+    Negate,
+    Absolute,
+    Sign,
+    Sine,
+    Select // destination = a != 0 ? b : c
+};
+
+struct BehaviourInstruction {
+    BehaviourOpcode opcode{BehaviourOpcode::Copy};
+    std::uint8_t destination{0};
+    std::uint8_t a{0};
+    std::uint8_t b{0};
+    std::uint8_t c{0};
+};
+
+// A behaviour script compiled to register bytecode. Scripts are lines of
+// `name = expression` with + - * / < <= > >= == != and or not, parentheses
+// and abs() sign() sin() min() max() select(); # starts a comment.
+// Names are the inputs, uniforms and outputs above in snake_case, m0..m3,
+// or locals defined by an earlier line.
+class BehaviourProgram {
+public:
+    // Replaces the program; on failure the program is left empty and error
+    // holds the first problem with its line number
+    [[nodiscard]] bool Compile(const std::string& source, std::string& error);
+    [[nodiscard]] bool LoadFromFile(const std::string& path, std::string& error);
+    void Clear() noexcept;
+
+    // Getters
+    [[nodiscard]] bool IsValid() const noexcept { return !m_code.empty(); }
+    [[nodiscard]] const std::vector<BehaviourInstruction>& GetCode() const noexcept { return m_code; }
+    [[nodiscard]] const std::vector<std::pair<std::uint8_t, float>>& GetConstants() const noexcept { return m_constants; }
+    [[nodiscard]] std::size_t GetRegisterCount() const noexcept { return m_registerCount; }
+
+    // Fixed register layout shared by the compiler and the VM
+    static constexpr std::size_t FIRST_INPUT_REGISTER = 0;
+    static constexpr std::size_t FIRST_UNIFORM_REGISTER = FIRST_INPUT_REGISTER + BEHAVIOUR_INPUT_COUNT;
+    static constexpr std::size_t FIRST_MEMORY_REGISTER = FIRST_UNIFORM_REGISTER + BEHAVIOUR_UNIFORM_COUNT;
+    static constexpr std::size_t FIRST_OUTPUT_REGISTER = FIRST_MEMORY_REGISTER + BEHAVIOUR_MEMORY_COUNT;
+    static constexpr std::size_t FIRST_FREE_REGISTER = FIRST_OUTPUT_REGISTER + BEHAVIOUR_OUTPUT_COUNT;
+    static constexpr std::size_t MAX_REGISTERS = 256; // Operands are one byte
+
+private:
+    // Member variables
+    std::vector<BehaviourInstruction> m_code;
+    std::vector<std::pair<std::uint8_t, float>> m_constants; // Register and value, broadcast before each run
+    std::size_t m_registerCount{FIRST_FREE_REGISTER};
+};
+
+// Runs one program over a whole batch of enemies at once. Every register is a
+// column with one lane per enemy, and each instruction is a single loop over
+// the lanes, so the interpreter's dispatch cost is paid per instruction rather
+// than per enemy and the loops themselves can be vectorised.
+class BehaviourVM {
+public:
+    // Sizes the columns for program over laneCount enemies and zeroes the
+    // outputs; fill the inputs and memory afterwards, then Execute the same program
+    void Prepare(const BehaviourProgram& program, std::size_t laneCount);
+    void Execute(const BehaviourProgram& program) noexcept;
+
+    // Columns, laneCount long
+    [[nodiscard]] float* GetInput(BehaviourInput input) noexcept;
+    [[nodiscard]] float* GetMemory(std::size_t slot) noexcept;
+    [[nodiscard]] const float* GetOutput(BehaviourOutput output) const noexcept;
+    void SetUniform(BehaviourUniform uniform, float value) noexcept;
+
+    // Getters
+    [[nodiscard]] std::size_t GetLaneCount() const noexcept { return m_laneCount; }
+
+private:
+    // Constants
+    static constexpr std::size_t LANE_BLOCK = 256; // Lanes per pass, keeps the live columns in cache
+
+    // Member variables
+    std::vector<float> m_registers; // One column of m_laneCount floats per register
+    std::array<float, BEHAVIOUR_UNIFORM_COUNT> m_uniforms{};
+    std::size_t m_laneCount{0};
+    std::size_t m_registerCount{0};
+
+    // Private helper methods
+    [[nodiscard]] float* GetColumn(std::size_t reg) noexcept { return m_registers.data() + reg * m_laneCount; }
+    void ExecuteBlock(const BehaviourProgram& program, std::size_t first, std::size_t count) noexcept;
+};
+
+} // namespace PlayAsGobo
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "InputFrame.hpp"
+#include "LatencyHistogram.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace PlayAsGobo {
+
+// One stage of the scripted benchmark scene
+struct BenchmarkPhase {
+    const char* name;
+    float duration;           // Simulated seconds
+    int maxEnemies;
+    float enemySpawnInterval; // Seconds between spawns
+    float explosionInterval;  // Seconds between scripted explosions, 0 disables them
+};
+
+inline constexpr std::array<BenchmarkPhase, 4> BENCHMARK_PHASES = {{
+    {"Warmup",  4.0f,  3, 1.00f, 0.0f},
+    {"Crowd",   8.0f, 20, 0.25f, 0.0f},
+    {"Barrage", 8.0f,  5, 1.00f, 0.2f},
+    {"Mayhem", 10.0f, 20, 0.15f, 0.1f}
+}};
+
+inline constexpr std::size_t BENCHMARK_PHASE_COUNT = BENCHMARK_PHASES.size();
+
+// Machine the benchmark ran on, so results from different kiosks can be told apart
+struct HardwareInfo {
+    std::string cpu;
+    std::string gpu;
+    std::string glVersion;
+    std::string operatingSystem;
+    std::uint32_t hardwareThreads{0};
+    std::int32_t screenWidth{0};
+    std::int32_t screenHeight{0};
+    std::int32_t refreshRate{0};
+
+    // Queries the OS and the current GL context
+    [[nodiscard]] static HardwareInfo Describe();
+};
+
+// Drives the built-in benchmark scene. The simulation always advances by
+// FIXED_DELTA_TIME from a fixed seed, so every machine does exactly the same
+// work; only the wall-clock time of each frame is measured. The score is
+// 1000 x (1/60 s) / geometric mean of the per-phase p95 frame times, so 1000
+// means the 95th percentile frame held 60 FPS in every phase and higher is better.
+class Benchmark {
+public:
+    // Constants
+    static constexpr std::uint32_t SCENE_SEED = 0x60B0BE4Cu;
+    static constexpr float FIXED_DELTA_TIME = 1.0f / 60.0f;
+    static constexpr float SCRIPTED_TURN_INTERVAL = 2.0f; // Gobo changes direction this often
+
+    // Constructor
+    Benchmark() = default;
+
+    // Disable copy and move operations (single owner in Game)
+    Benchmark(const Benchmark&) = delete;
+    Benchmark& operator=(const Benchmark&) = delete;
+    Benchmark(Benchmark&&) = delete;
+    Benchmark& operator=(Benchmark&&) = delete;
+
+    // Destructor
+    ~Benchmark() = default;
+
+    // Run control
+    void Start() noexcept;
+    void Cancel() noexcept;
+
+    // Per frame: record the wall time of the previous frame, then advance the script.
+    // Advance returns false once the last phase has finished.
+    void RecordFrame(double frameSeconds) noexcept;
+    [[nodiscard]] bool Advance(float deltaTime) noexcept;
+    [[nodiscard]] bool ConsumeExplosionTrigger() noexcept;
+    [[nodiscard]] InputFrame GetScriptedInput(const InputFrame& liveInput) const noexcept;
+
+    // Results
+    [[nodiscard]] double ComputeScore() const;
+    void WriteSummary(std::ostream& stream, const HardwareInfo& hardware) const;
+    [[nodiscard]] bool SaveReport(const std::string& path, const HardwareInfo& hardware) const;
+
+    // Getters
+    [[nodiscard]] bool IsRunning() const noexcept { return m_isRunning; }
+    [[nodiscard]] std::size_t GetPhaseIndex() const noexcept { return m_phaseIndex; }
+    [[nodiscard]] const BenchmarkPhase& GetCurrentPhase() const noexcept;
+    [[nodiscard]] float GetProgress() const noexcept;
+
+private:
+    // Member variables
+    std::array<LatencyHistogram, BENCHMARK_PHASE_COUNT> m_frameTimes;
+    std::size_t m_phaseIndex{0};
+    float m_phaseTime{0.0f};
+    float m_elapsedTime{0.0f};
+    float m_explosionTimer{0.0f};
+    bool m_explosionPending{false};
+    bool m_skipNextFrame{false}; // The first frame includes session setup
+    bool m_isRunning{false};
+};
+
+} // namespace PlayAsGobo
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "Entity.hpp"
+#include "EnemyArchetype.hpp"
+#include "BehaviourVM.hpp"
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <cstdint>
 
@@ -8,19 +12,33 @@ namespace PlayAsGobo {
 
 // Forward declarations
 class Player;
+class ProjectileSystem;
 
 enum class EnemyDirection : std::uint8_t {
     Right,
     Left
 };
 
-class Enemy : public Entity {
+// Per-tick inputs shared by every enemy AI kernel
+struct EnemyAIContext {
+    float deltaTime{0.0f};
+    float mapWidth{0.0f};
+    float finishLineX{0.0f};
+    float groundY{0.0f};
+    float gravity{0.0f};
+    const Player* player{nullptr};
+    ProjectileSystem* projectiles{nullptr}; // Where throwing archetypes put their shots
+};
+
+// Final so calls through Enemy* in the per-archetype loops are not virtual
+class Enemy final : public Entity {
 public:
     // Constructor
     Enemy(float x, float y, float radius,
           const std::vector<Texture2D>& enemyTextures,
           float speed = 200.0f, 
-          EnemyDirection initialDirection = EnemyDirection::Right);
+          EnemyDirection initialDirection = EnemyDirection::Right,
+          EnemyArchetype archetype = EnemyArchetype::Walker);
     
     // Disable copy operations (enemies should be unique)
     Enemy(const Enemy&) = delete;
@@ -38,15 +56,23 @@ public:
     [[nodiscard]] bool IsMoving() const noexcept { return m_isMoving; }
     [[nodiscard]] float GetMoveSpeed() const noexcept { return m_moveSpeed; }
     [[nodiscard]] std::int32_t GetCurrentFrame() const noexcept { return static_cast<std::int32_t>(m_currentFrame); }
+    [[nodiscard]] EnemyArchetype GetArchetype() const noexcept { return m_archetype; }
+    [[nodiscard]] float GetGravityScale() const noexcept { return m_gravityScale; }
+    [[nodiscard]] std::uint16_t GetSerialNumber() const noexcept { return m_serialNumber; }
     
     // Actions
     void FlipDirection() noexcept;
     void SetDirection(EnemyDirection direction) noexcept { m_direction = direction; }
     void SetMoveSpeed(float speed);
+    void SetSerialNumber(std::uint16_t serialNumber) noexcept { m_serialNumber = serialNumber; }
+    
+    // AI and behavior: runs one archetype's kernel over an array of enemies of that archetype
+    template<EnemyArchetype Archetype>
+    static void ExecuteAIBatch(Enemy* const* enemies, std::size_t count, const EnemyAIContext& context) noexcept;
     
-    // AI and behavior
-    void ExecuteAI(float deltaTime, float mapWidth, float finishLineX,
-                  const Player& player, bool soundEnabled);
+    // Same, driven by a behaviour script; the VM decides for the whole batch at once
+    static void ExecuteScriptedAIBatch(Enemy* const* enemies, std::size_t count, const BehaviourProgram& program,
+                                       BehaviourVM& vm, const EnemyAIContext& context);
     
     // Override virtual methods from Entity
     void Update(float deltaTime) override;
@@ -63,6 +89,16 @@ private:
     static constexpr float PLAYER_DETECTION_RANGE = 200.0f;
     static constexpr float VOLUME_DISTANCE_FACTOR = 1000.0f;
     static constexpr float MIN_VOLUME_DISTANCE = 1.0f;
+    static constexpr float FLYER_HOVER_HEIGHT = 140.0f;
+    static constexpr float FLYER_BOB_AMPLITUDE = 20.0f;
+    static constexpr float FLYER_BOB_SPEED = 3.0f;
+    static constexpr float FLYER_STEERING = 4.0f;
+    static constexpr float THROW_RANGE = 600.0f;
+    static constexpr float THROW_SPEED = 260.0f;           // Horizontal speed of a lob
+    static constexpr float MIN_THROW_FLIGHT_TIME = 0.35f;  // Keeps close throws from going flat
+    static constexpr float THROW_GRAVITY_SCALE = 0.5f;
+    static constexpr float THROW_RADIUS = 6.0f;
+    static constexpr float THROW_LIFETIME = 4.0f;
     
     // Animation frame indices
     enum class AnimationFrame : std::uint8_t {
@@ -73,12 +109,18 @@ private:
     };
     
     // Member variables
-    std::vector<Texture2D> m_textures;
+    const std::vector<Texture2D>* m_textures; // Shared with Game, must outlive the enemy
     float m_moveSpeed;
     float m_animationTimer{0.0f};
     AnimationFrame m_currentFrame{AnimationFrame::Idle};
     EnemyDirection m_direction;
+    EnemyArchetype m_archetype;
+    float m_gravityScale;
+    float m_behaviourTimer{0.0f};
+    float m_throwTimer{0.0f};
+    std::array<float, BEHAVIOUR_MEMORY_COUNT> m_behaviourMemory{}; // m0..m3 of the behaviour script
     bool m_isMoving{false};
+    std::uint16_t m_serialNumber{0}; // Spawn order within the session, identifies the enemy to spectators
     
     // Private helper methods
     void ValidateTextures() const;
@@ -86,6 +128,11 @@ private:
     void UpdateAnimation(float deltaTime);
     void UpdateMovement(float deltaTime, float mapWidth, float finishLineX);
     void HandlePlayerProximityJump(const Player& player);
+    void HandleTimedHop(float deltaTime, float hopInterval) noexcept;
+    void UpdateHover(float deltaTime, float groundY) noexcept;
+    void HandleThrow(float deltaTime, float throwInterval, float gravity,
+                     const Player& player, ProjectileSystem& projectiles) noexcept;
+    void ThrowAt(const Player& player, float gravity, ProjectileSystem& projectiles) noexcept;
     [[nodiscard]] bool ShouldMoveRight(float finishLineX, float mapWidth) const noexcept;
     [[nodiscard]] bool ShouldMoveLeft(float finishLineX) const noexcept;
     [[nodiscard]] bool IsPlayerInJumpRange(const Player& player) const noexcept;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace PlayAsGobo {
+
+enum class EnemyArchetype : std::uint8_t {
+    Walker,  // Runs for the finish line, jumps when Gobo is ahead
+    Jumper,  // Hops on a timer as well as at Gobo
+    Flyer,   // Ignores gravity, hovers above the ground and throws at Gobo
+    Heavy,   // Large, slow and never leaves the ground; lobs rocks at Gobo
+    Count
+};
+
+inline constexpr std::size_t ENEMY_ARCHETYPE_COUNT = static_cast<std::size_t>(EnemyArchetype::Count);
+
+// Compile-time behaviour of each archetype; the AI kernels are instantiated per
+// archetype so every branch on these values folds away.
+template<EnemyArchetype Archetype>
+struct EnemyArchetypeTraits;
+
+template<>
+struct EnemyArchetypeTraits<EnemyArchetype::Walker> {
+    static constexpr float SPEED_SCALE = 1.0f;
+    static constexpr float RADIUS_SCALE = 1.0f;
+    static constexpr float GRAVITY_SCALE = 1.0f;
+    static constexpr bool JUMPS_AT_PLAYER = true;
+    static constexpr float HOP_INTERVAL = 0.0f; // 0 disables timed hops
+    static constexpr float THROW_INTERVAL = 0.0f; // 0 never throws
+    static constexpr bool FLIES = false;
+    static constexpr Color TINT = {255, 255, 255, 255};
+};
+
+template<>
+struct EnemyArchetypeTraits<EnemyArchetype::Jumper> {
+    static constexpr float SPEED_SCALE = 1.15f;
+    static constexpr float RADIUS_SCALE = 0.85f;
+    static constexpr float GRAVITY_SCALE = 1.0f;
+    static constexpr bool JUMPS_AT_PLAYER = true;
+    static constexpr float HOP_INTERVAL = 1.2f;
+    static constexpr float THROW_INTERVAL = 0.0f;
+    static constexpr bool FLIES = false;
+    static constexpr Color TINT = {170, 255, 150, 255};
+};
+
+template<>
+struct EnemyArchetypeTraits<EnemyArchetype::Flyer> {
+    static constexpr float SPEED_SCALE = 0.8f;
+    static constexpr float RADIUS_SCALE = 0.75f;
+    static constexpr float GRAVITY_SCALE = 0.0f;
+    static constexpr bool JUMPS_AT_PLAYER = false;
+    static constexpr float HOP_INTERVAL = 0.0f;
+    static constexpr float THROW_INTERVAL = 2.5f;
+    static constexpr bool FLIES = true;
+    static constexpr Color TINT = {160, 210, 255, 255};
+};
+
+template<>
+struct EnemyArchetypeTraits<EnemyArchetype::Heavy> {
+    static constexpr float SPEED_SCALE = 0.6f;
+    static constexpr float RADIUS_SCALE = 1.35f;
+    static constexpr float GRAVITY_SCALE = 1.5f;
+    static constexpr bool JUMPS_AT_PLAYER = false;
+    static constexpr float HOP_INTERVAL = 0.0f;
+    static constexpr float THROW_INTERVAL = 3.5f;
+    static constexpr bool FLIES = false;
+    static constexpr Color TINT = {255, 190, 150, 255};
+};
+
+// Spawn-time values for code that only knows the archetype at run time
+struct EnemyArchetypeParams {
+    float speedScale;
+    float radiusScale;
+    float gravityScale;
+    Color tint;
+};
+
+template<EnemyArchetype Archetype>
+inline constexpr EnemyArchetypeParams ENEMY_ARCHETYPE_PARAMS = {
+    EnemyArchetypeTraits<Archetype>::SPEED_SCALE,
+    EnemyArchetypeTraits<Archetype>::RADIUS_SCALE,
+    EnemyArchetypeTraits<Archetype>::GRAVITY_SCALE,
+    EnemyArchetypeTraits<Archetype>::TINT
+};
+
+[[nodiscard]] constexpr const EnemyArchetypeParams& GetEnemyArchetypeParams(EnemyArchetype archetype) noexcept {
+    switch (archetype) {
+        case EnemyArchetype::Jumper: return ENEMY_ARCHETYPE_PARAMS<EnemyArchetype::Jumper>;
+        case EnemyArchetype::Flyer:  return ENEMY_ARCHETYPE_PARAMS<EnemyArchetype::Flyer>;
+        case EnemyArchetype::Heavy:  return ENEMY_ARCHETYPE_PARAMS<EnemyArchetype::Heavy>;
+        case EnemyArchetype::Walker:
+        case EnemyArchetype::Count:
+        default:                     return ENEMY_ARCHETYPE_PARAMS<EnemyArchetype::Walker>;
+    }
+}
+
+// Calls function once per archetype with a std::integral_constant tag, so callers
+// can pick the matching kernel at compile time
+template<typename Function>
+constexpr void ForEachEnemyArchetype(Function&& function) {
+    function(std::integral_constant<EnemyArchetype, EnemyArchetype::Walker>{});
+    function(std::integral_constant<EnemyArchetype, EnemyArchetype::Jumper>{});
+    function(std::integral_constant<EnemyArchetype, EnemyArchetype::Flyer>{});
+    function(std::integral_constant<EnemyArchetype, EnemyArchetype::Heavy>{});
+}
+
+} // namespace PlayAsGobo
@@ -6,6 +6,8 @@
 
 namespace PlayAsGobo {
 
+class Ground;
+
 struct Circle {
     Vector2 center{0.0f, 0.0f};
     float radius{0.0f};
@@ -39,6 +41,7 @@ public:
     [[nodiscard]] float GetVelocityY() const noexcept { return m_velocityY; }
     [[nodiscard]] bool IsOnGround() const noexcept { return m_isOnGround; }
     [[nodiscard]] bool CanPhase() const noexcept { return m_canPhase; }
+    [[nodiscard]] const Ground* GetSupport() const noexcept { return m_support; } // Ground last landed on
     
     // Setters with validation
     void SetPosition(Vector2 position) noexcept;
@@ -49,6 +52,7 @@ public:
     void SetVelocityY(float velocity) noexcept { m_velocityY = velocity; }
     void SetOnGround(bool onGround) noexcept { m_isOnGround = onGround; }
     void SetCanPhase(bool canPhase) noexcept { m_canPhase = canPhase; }
+    void SetSupport(const Ground* ground) noexcept { m_support = ground; }
     
     // Movement methods
     void Move(Vector2 delta) noexcept;
@@ -72,6 +76,7 @@ protected:
     float m_velocityY{0.0f};
     bool m_isOnGround{false};
     bool m_canPhase{false};
+    const Ground* m_support{nullptr}; // Non-owning; only meaningful while on the ground
     
 private:
     // Private validation methods
@@ -2,12 +2,22 @@
 
 #include "raylib.h"
 #include "raymath.h"
+#include "LightBuffer.hpp"
+#include "QuadWriter.hpp"
 #include <vector>
 #include <cstdint>
 #include <memory>
 
 namespace PlayAsGobo {
 
+// Where an explosion is in its life; only the Damage phase takes part in collision queries
+enum class ExplosionPhase : std::uint8_t {
+    Arming,     // Started this tick, joins damage queries on its first update
+    Damage,     // Blast front expanding, hurts what it touches
+    VisualTail, // Fire and particles fading out, render only
+    Retired     // Idle in the pool, waiting to be reused
+};
+
 class Explosion {
 public:
     // Constructor
@@ -32,14 +42,19 @@ public:
     // Updates and rendering
     void Update(float deltaTime);
     void Draw() const;
+    void AppendGlowQuad(QuadWriter& quads) const; // Inside an RL_QUADS batch; see ExplosionManager::DrawGlow
+    void AddLights(LightBuffer& lights) const;
     
     // Getters
     [[nodiscard]] bool IsActive() const noexcept { return m_isActive; }
     [[nodiscard]] Vector2 GetPosition() const noexcept { return m_position; }
     [[nodiscard]] float GetRadius() const noexcept;
+    [[nodiscard]] float GetMaxRadius() const noexcept { return m_maxRadius; }
     [[nodiscard]] float GetDamageRadius() const noexcept;
     [[nodiscard]] float GetProgress() const noexcept;
     [[nodiscard]] bool IsInDamagePhase() const noexcept;
+    [[nodiscard]] ExplosionPhase GetPhase() const noexcept;
+    [[nodiscard]] float GetGlowRadius() const noexcept;
     
     // Configuration
     void SetMaxDuration(float duration);
@@ -62,6 +77,9 @@ private:
     static constexpr float MAX_PARTICLE_LIFE = 1.5f;
     static constexpr float MIN_PARTICLE_SIZE = 3.0f;
     static constexpr float MAX_PARTICLE_SIZE = 8.0f;
+    static constexpr float CORE_LIGHT_SCALE = 1.5f;        // Light radius relative to the blast
+    static constexpr float PARTICLE_LIGHT_SCALE = 3.0f;    // Light radius relative to a particle
+    static constexpr float HOT_PARTICLE_LIFE_RATIO = 0.6f; // Particles glow while white or yellow
     
     // Particle structure
     struct Particle {
@@ -97,12 +115,19 @@ private:
     void UpdateParticles(float deltaTime);
     void UpdateParticle(Particle& particle, float deltaTime);
     [[nodiscard]] Color CalculateParticleColor(float lifeRatio) const noexcept;
+    [[nodiscard]] float GetDamagePhaseDuration() const noexcept;
     void DrawExplosionCore() const;
     void DrawParticles() const;
     [[nodiscard]] float GenerateRandomFloat(float min, float max) const;
     [[nodiscard]] std::int32_t GenerateRandomInt(int min, int max) const;
 };
 
+// Where and how big an explosion went off, kept until the world has reacted to it
+struct ExplosionImpact {
+    Vector2 position{0.0f, 0.0f};
+    float radius{0.0f};
+};
+
 class ExplosionManager {
 public:
     // Constructor
@@ -123,15 +148,23 @@ public:
     void CreateExplosion(Vector2 position, const Sound& explosionSound, bool soundEnabled);
     void Update(float deltaTime);
     void Draw() const;
+    void DrawGlow(const Texture2D& glowSprite) const; // One sprite per explosion instead of its particles
+    void AddLights(LightBuffer& lights) const;
     void Clear() noexcept;
     
-    // Damage detection
+    // Damage detection (only explosions in their damage window are tested)
     [[nodiscard]] bool CheckExplosionDamage(Vector2 position, float radius) const noexcept;
     [[nodiscard]] std::vector<Vector2> GetActiveExplosionPositions() const;
     
+    // Terrain destruction (explosions started since the last ClearPendingImpacts)
+    [[nodiscard]] const std::vector<ExplosionImpact>& GetPendingImpacts() const noexcept { return m_pendingImpacts; }
+    void ClearPendingImpacts() noexcept { m_pendingImpacts.clear(); }
+    
     // State queries
     [[nodiscard]] std::size_t GetActiveExplosionCount() const noexcept;
     [[nodiscard]] std::size_t GetTotalExplosionCount() const noexcept { return m_explosions.size(); }
+    [[nodiscard]] std::size_t GetDamagingExplosionCount() const noexcept { return m_damageQueries.size(); }
+    [[nodiscard]] const std::vector<Explosion>& GetExplosions() const noexcept { return m_explosions; }
     [[nodiscard]] bool HasActiveExplosions() const noexcept;
     
     // Configuration
@@ -144,15 +177,18 @@ private:
     static constexpr std::size_t MIN_MAX_EXPLOSIONS = 1;
     static constexpr std::size_t MAX_MAX_EXPLOSIONS = 500;
     
-    // Member variables
-    std::vector<std::unique_ptr<Explosion>> m_explosions;
+    // Member variables (stored by value and recycled; never freed during a session)
+    std::vector<Explosion> m_explosions;
     std::size_t m_maxExplosions{DEFAULT_MAX_EXPLOSIONS};
+    std::vector<ExplosionImpact> m_pendingImpacts;
+    std::vector<std::size_t> m_damageQueries; // Indices into m_explosions, rebuilt every update
     
     // Private helper methods
     void ValidateMaxExplosions(std::size_t maxCount) const;
     [[nodiscard]] Explosion* FindInactiveExplosion() noexcept;
-    void CreateNewExplosion(Vector2 position, const Sound& explosionSound, bool soundEnabled);
+    Explosion* CreateNewExplosion(Vector2 position, const Sound& explosionSound, bool soundEnabled);
     void CleanupInactiveExplosions();
+    void RebuildDamageQueries();
 };
 
 } // namespace PlayAsGobo
\ No newline at end of file
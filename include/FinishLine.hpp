@@ -1,8 +1,10 @@
 #pragma once
 
 #include "raylib.h"
+#include "StaticTileMesh.hpp"
 #include <cmath>
 #include <cstdint>
+#include <vector>
 
 namespace PlayAsGobo {
 
@@ -42,6 +44,7 @@ public:
     [[nodiscard]] Vector2 GetSize() const noexcept { return {m_bounds.width, m_bounds.height}; }
     [[nodiscard]] Vector2 GetCenter() const noexcept;
     [[nodiscard]] bool HasTexture() const noexcept { return m_hasTexture; }
+    [[nodiscard]] const Texture2D& GetTexture() const noexcept { return m_texture; }
     [[nodiscard]] Color GetTintColor() const noexcept { return m_tintColor; }
     [[nodiscard]] float GetArea() const noexcept { return m_bounds.width * m_bounds.height; }
     [[nodiscard]] bool IsActive() const noexcept { return m_isActive; }
@@ -79,6 +82,7 @@ public:
     void DrawWithAnimation(float animationTime) const;
     void DrawOutline(Color outlineColor = BLACK, float thickness = 2.0f) const;
     void DrawWithOffset(Vector2 offset) const;
+    void CollectTiles(std::vector<StaticTile>& tiles) const; // Textured tiles for baking into a StaticTileMesh
 
 private:
     // Constants
@@ -106,6 +110,8 @@ private:
     void DrawAnimatedFinishLine(float animationTime) const;
     void CalculateTileLayout(float textureWidth, float textureHeight,
                            std::int32_t& tilesX, std::int32_t& tilesY) const;
+    [[nodiscard]] bool ComputeTile(float textureWidth, float textureHeight, std::int32_t tileX, std::int32_t tileY,
+                                   Rectangle& destRect, Rectangle& sourceRect) const noexcept;
     void DrawTile(float textureWidth, float textureHeight,
                  std::int32_t tileX, std::int32_t tileY) const;
     void DrawAnimatedTile(float textureWidth, float textureHeight,
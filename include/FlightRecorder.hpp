@@ -0,0 +1,116 @@
+#pragma once
+
+#include "InputFrame.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Timed sections of a frame, stored per record
+enum class FlightZone : std::uint8_t {
+    Update,
+    Render,
+    Count
+};
+
+inline constexpr std::size_t FLIGHT_ZONE_COUNT = static_cast<std::size_t>(FlightZone::Count);
+
+// One frame of history. Input, delta time and the session seed are enough to
+// re-simulate a session from its SessionStart record; the rest is for inspection.
+struct FlightRecord {
+    static constexpr std::uint8_t FLAG_SESSION_START = 1u << 0;
+
+    std::uint32_t frameIndex{0};
+    float deltaTime{0.0f};
+    std::uint32_t sessionSeed{0};
+    std::uint8_t gameState{0};
+    std::uint8_t flags{0};
+    InputFrame input{};
+    std::int16_t screenWidth{0};
+    std::int16_t screenHeight{0};
+    float playerX{0.0f};
+    float playerY{0.0f};
+    float playerRadius{0.0f};
+    std::uint16_t enemyCount{0};
+    std::uint16_t explosionCount{0};
+    std::int32_t killCount{0};
+    std::uint64_t stateHash{0}; // Combined StateHasher value after the tick, 0 outside gameplay
+    std::array<std::uint32_t, FLIGHT_ZONE_COUNT> zoneMicroseconds{};
+};
+
+// Fixed header at the start of every dump, followed by recordCount records oldest first
+struct FlightDumpHeader {
+    std::array<char, 8> magic{};
+    std::uint32_t version{0};
+    std::uint32_t recordSize{0};
+    std::uint32_t recordCount{0};
+    std::int32_t reason{0};           // Signal number, 0 for an uncaught exception
+    std::array<char, 128> message{};
+};
+
+static_assert(std::is_trivially_copyable_v<FlightRecord>, "FlightRecord is written with raw I/O");
+static_assert(std::is_trivially_copyable_v<FlightDumpHeader>, "FlightDumpHeader is written with raw I/O");
+
+// Keeps the last few seconds of frames in a preallocated ring and writes them
+// to disk when the process crashes. The dump path only uses async-signal-safe
+// calls (open/write/close) so it can run from a SIGSEGV or SIGABRT handler.
+class FlightRecorder {
+public:
+    // Constructor
+    explicit FlightRecorder(std::size_t capacity = DEFAULT_CAPACITY);
+
+    // Disable copy and move operations (signal handlers hold a pointer to the recorder)
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+    FlightRecorder(FlightRecorder&&) = delete;
+    FlightRecorder& operator=(FlightRecorder&&) = delete;
+
+    // Destructor
+    ~FlightRecorder();
+
+    // Crash handler registration (one recorder may be installed at a time)
+    void Install(const std::string& dumpPath);
+    void Uninstall() noexcept;
+
+    // Recording
+    void Record(const FlightRecord& record) noexcept;
+    void DumpException(const char* message) noexcept;
+
+    // Getters
+    [[nodiscard]] std::size_t GetCapacity() const noexcept { return m_capacity; }
+    [[nodiscard]] std::size_t GetRecordCount() const noexcept;
+    [[nodiscard]] bool IsInstalled() const noexcept { return m_isInstalled; }
+
+    // Reads a dump written by this class; returns false and logs on malformed files
+    [[nodiscard]] static bool LoadDump(const std::string& path, FlightDumpHeader& header,
+                                       std::vector<FlightRecord>& records);
+
+private:
+    // Constants
+    static constexpr std::size_t DEFAULT_CAPACITY = 60 * 20; // ~20 seconds at 60 FPS
+    static constexpr std::size_t MIN_CAPACITY = 16;
+    static constexpr std::size_t MAX_CAPACITY = 60 * 60 * 10;
+    static constexpr std::uint32_t DUMP_VERSION = 2;
+    static constexpr std::size_t MAX_PATH_LENGTH = 512;
+
+    // Member variables
+    std::unique_ptr<FlightRecord[]> m_records;
+    std::size_t m_capacity;
+    std::atomic<std::uint64_t> m_writeCount{0};
+    std::array<char, MAX_PATH_LENGTH> m_dumpPath{};
+    bool m_isInstalled{false};
+
+    // Private helper methods
+    void ValidateCapacity(std::size_t capacity) const;
+    bool WriteDump(std::int32_t reason, const char* message) const noexcept;
+    static void HandleSignal(int signal);
+    static void FillMagic(std::array<char, 8>& magic) noexcept;
+};
+
+} // namespace PlayAsGobo
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "raylib.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace PlayAsGobo {
+
+enum class CaptureFormat : std::uint8_t {
+    Gif,        // Single animated GIF (msf_gif)
+    QoiFrames,  // One .qoi image per frame inside a directory
+    RawFrames   // Concatenated RGBA8 frames in a single .rgba file
+};
+
+// Records gameplay without stalling the render loop. Frames are read back through
+// two alternating pixel-pack buffers (the GPU copy of frame N overlaps frame N+1),
+// downscaled on the main thread and encoded on a background thread.
+class FrameCapture {
+public:
+    // Constructor
+    FrameCapture() = default;
+
+    // Disable copy and move operations (owns a thread and GPU buffers)
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+    FrameCapture(FrameCapture&&) = delete;
+    FrameCapture& operator=(FrameCapture&&) = delete;
+
+    // Destructor
+    ~FrameCapture();
+
+    // Recording control (requires a current GL context)
+    [[nodiscard]] bool Start(const std::string& outputPath, CaptureFormat format,
+                             std::int32_t downscale = DEFAULT_DOWNSCALE);
+    void Stop();
+
+    // Call once per frame after everything is drawn, right before EndDrawing()
+    void CaptureFrame();
+
+    // State queries
+    [[nodiscard]] bool IsRecording() const noexcept { return m_isRecording; }
+    [[nodiscard]] const std::string& GetOutputPath() const noexcept { return m_outputPath; }
+    [[nodiscard]] std::uint32_t GetCapturedFrameCount() const noexcept { return m_capturedFrames; }
+    [[nodiscard]] std::uint32_t GetDroppedFrameCount() const noexcept { return m_droppedFrames; }
+
+private:
+    // Constants
+    static constexpr std::int32_t DEFAULT_DOWNSCALE = 2;
+    static constexpr std::int32_t MIN_DOWNSCALE = 1;
+    static constexpr std::int32_t MAX_DOWNSCALE = 8;
+    static constexpr std::size_t FRAME_POOL_SIZE = 8;
+    static constexpr std::int32_t GIF_MAX_BIT_DEPTH = 16;
+    static constexpr double GIF_MIN_FRAME_INTERVAL = 0.02; // GIF delays below 2cs are clamped by viewers
+
+    // Downscaled frame waiting for the encoder
+    struct CapturedFrame {
+        std::vector<std::uint8_t> pixels;
+        double duration{0.0};
+    };
+
+    // Capture configuration
+    std::string m_outputPath;
+    CaptureFormat m_format{CaptureFormat::Gif};
+    std::int32_t m_downscale{DEFAULT_DOWNSCALE};
+    std::int32_t m_sourceWidth{0};
+    std::int32_t m_sourceHeight{0};
+    std::int32_t m_frameWidth{0};
+    std::int32_t m_frameHeight{0};
+    double m_minFrameInterval{0.0};
+    double m_lastCaptureTime{0.0};
+
+    // GPU readback (double-buffered pixel pack buffers)
+    std::array<unsigned int, 2> m_pixelBuffers{};
+    std::array<bool, 2> m_pixelBufferPending{};
+    std::size_t m_writeBufferIndex{0};
+    bool m_usePixelBuffers{false};
+
+    // Encoder hand-off
+    std::thread m_encoderThread;
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::array<CapturedFrame, FRAME_POOL_SIZE> m_framePool;
+    std::vector<std::size_t> m_freeFrames;
+    std::deque<std::size_t> m_readyFrames;
+    bool m_stopRequested{false};
+
+    // Statistics
+    std::atomic<bool> m_isRecording{false};
+    std::atomic<std::uint32_t> m_capturedFrames{0};
+    std::atomic<std::uint32_t> m_droppedFrames{0};
+
+    // Private helper methods
+    void ValidateDownscale(std::int32_t downscale) const;
+    [[nodiscard]] bool CreatePixelBuffers();
+    void DestroyPixelBuffers() noexcept;
+    void ReadbackPixelBuffer(std::size_t index, double duration);
+    void SubmitFrame(const std::uint8_t* pixels, bool bottomUp, double duration);
+    void RunEncoder();
+};
+
+} // namespace PlayAsGobo
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Game state a frame task can touch, one bit each
+enum class FrameResource : std::uint16_t {
+    Input       = 1u << 0,
+    Camera      = 1u << 1,
+    Session     = 1u << 2,  // Game state, difficulty and benchmark progress
+    Random      = 1u << 3,  // The session's seeded generator
+    Player      = 1u << 4,
+    Enemies     = 1u << 5,  // Enemies, their batches and the spawner
+    Explosions  = 1u << 6,
+    Projectiles = 1u << 7,  // Including the per-tick hit flags
+    Terrain     = 1u << 8,  // Grounds and the destructible mask
+    Audio       = 1u << 9,  // AudioCommands has a single producer
+    Diagnostics = 1u << 10, // State hashes and the spectator stream
+    Ghosts      = 1u << 11  // Ghost recording and playback cursors
+};
+
+using FrameResourceMask = std::uint16_t;
+
+inline constexpr FrameResourceMask ALL_FRAME_RESOURCES = 0xFFFFu;
+
+template<typename... Resources>
+[[nodiscard]] constexpr FrameResourceMask MakeResourceMask(Resources... resources) noexcept {
+    return static_cast<FrameResourceMask>((0u | ... | static_cast<FrameResourceMask>(resources)));
+}
+
+// Per-frame systems as a dependency graph. Each task declares the resources it
+// reads and writes and waits for every earlier task it conflicts with (either
+// side writes something the other touches), so a run gives the same result as
+// calling the tasks one by one in the order they were added, while tasks with
+// disjoint resources run at the same time. The thread calling Run() works too,
+// and is the only one that runs main-thread tasks.
+class FrameGraph {
+public:
+    using TaskIndex = std::size_t;
+
+    // Constructor
+    FrameGraph() = default;
+
+    // Disable copy and move operations (owns threads)
+    FrameGraph(const FrameGraph&) = delete;
+    FrameGraph& operator=(const FrameGraph&) = delete;
+    FrameGraph(FrameGraph&&) = delete;
+    FrameGraph& operator=(FrameGraph&&) = delete;
+
+    // Destructor
+    ~FrameGraph();
+
+    // Worker threads, on top of the caller; zero runs everything on the caller
+    void Start(std::size_t workerCount);
+    void Stop();
+
+    // Building; only while no run is in progress
+    TaskIndex AddTask(std::string name, FrameResourceMask reads, FrameResourceMask writes,
+                      std::function<void()> work, bool mainThreadOnly = false);
+    void Clear();
+
+    // Runs every task once. An exception from a task cancels the rest of the run
+    // and is rethrown here once the tasks already started have finished.
+    void Run();
+    // From inside a task: tasks that have not started yet are skipped this run
+    void Cancel() noexcept { m_isCancelled.store(true, std::memory_order_relaxed); }
+
+    // Timings of the last run
+    [[nodiscard]] std::size_t GetTaskCount() const noexcept { return m_tasks.size(); }
+    [[nodiscard]] const std::string& GetTaskName(TaskIndex task) const { return m_tasks[task].name; }
+    [[nodiscard]] double GetTaskSeconds(TaskIndex task) const { return m_tasks[task].endTime - m_tasks[task].startTime; }
+    [[nodiscard]] bool WasTaskRun(TaskIndex task) const { return m_tasks[task].wasRun; }
+    [[nodiscard]] bool IsOnCriticalPath(TaskIndex task) const { return m_tasks[task].isOnCriticalPath; }
+    [[nodiscard]] bool WasCancelled() const noexcept { return m_isCancelled.load(std::memory_order_relaxed); }
+    [[nodiscard]] double GetCriticalPathSeconds() const noexcept { return m_criticalPathSeconds; }
+    [[nodiscard]] double GetWorkSeconds() const noexcept { return m_workSeconds; }
+    [[nodiscard]] double GetWallSeconds() const noexcept { return m_wallSeconds; }
+    [[nodiscard]] std::size_t GetWorkerCount() const noexcept { return m_workers.size(); }
+
+private:
+    struct Task {
+        std::string name;
+        FrameResourceMask reads{0};
+        FrameResourceMask writes{0};
+        std::function<void()> work;
+        bool mainThreadOnly{false};
+        std::vector<TaskIndex> dependents;
+        std::size_t dependencyCount{0};
+
+        // Per run
+        std::size_t pendingDependencies{0};
+        double startTime{0.0}; // Seconds since the run started
+        double endTime{0.0};
+        bool wasRun{false};
+        bool isOnCriticalPath{false};
+    };
+
+    // Member variables
+    std::vector<Task> m_tasks;
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_taskReady;
+    std::deque<TaskIndex> m_readyTasks;
+    std::deque<TaskIndex> m_readyMainTasks;
+    std::size_t m_remainingTasks{0};
+    std::exception_ptr m_exception;
+    std::atomic<bool> m_isCancelled{false};
+    bool m_isStopping{false};
+    double m_runStart{0.0};
+    double m_criticalPathSeconds{0.0};
+    double m_workSeconds{0.0};
+    double m_wallSeconds{0.0};
+
+    // Private helper methods
+    void RunWorker();
+    [[nodiscard]] std::exception_ptr Execute(TaskIndex task) noexcept;
+    void Complete(TaskIndex task, std::exception_ptr exception); // Holds m_mutex
+    void FindCriticalPath();
+    [[nodiscard]] static double GetSeconds() noexcept;
+};
+
+} // namespace PlayAsGobo
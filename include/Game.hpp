@@ -7,6 +7,25 @@
 #include "Ground.hpp"
 #include "FinishLine.hpp"
 #include "Explosion.hpp"
+#include "ProjectileSystem.hpp"
+#include "SessionArena.hpp"
+#include "FrameCapture.hpp"
+#include "GpuTimer.hpp"
+#include "LatencyHistogram.hpp"
+#include "FlightRecorder.hpp"
+#include "InputFrame.hpp"
+#include "TerrainMask.hpp"
+#include "StaticTileMesh.hpp"
+#include "LightBuffer.hpp"
+#include "AudioCommands.hpp"
+#include "Benchmark.hpp"
+#include "StateHash.hpp"
+#include "SpectatorServer.hpp"
+#include "ThreadTuning.hpp"
+#include "FrameGraph.hpp"
+#include "GhostRun.hpp"
+#include "GroundGrid.hpp"
+#include "PlatformSystem.hpp"
 
 #include <vector>
 #include <algorithm>
@@ -17,6 +36,7 @@
 #include <memory>
 #include <optional>
 #include <array>
+#include <chrono>
 #include <cstdint>
 
 namespace PlayAsGobo {
@@ -33,6 +53,7 @@ struct CollisionInfo {
     bool hasCollision{false};
     CollisionSide side{CollisionSide::None};
     float penetrationDepth{0.0f};
+    float contactCoordinate{0.0f}; // Surface the entity should rest against (x for walls, y otherwise)
     Ground* collidedGround{nullptr};
 };
 
@@ -43,9 +64,12 @@ enum class GameState : std::uint8_t {
     Controls,
     Options,
     AskExit,
+    Paused,
     Exit
 };
 
+inline constexpr std::size_t GAME_STATE_COUNT = static_cast<std::size_t>(GameState::Exit) + 1;
+
 struct Button {
     Rectangle bounds;
     const char* text;
@@ -77,6 +101,12 @@ public:
     Game& operator=(Game&&) = delete;
     
     [[nodiscard]] bool IsInitialized() const noexcept { return m_isInitialized; }
+    [[nodiscard]] bool StartReplay(const std::string& dumpPath);
+    void StartBenchmark(bool exitWhenDone);
+    [[nodiscard]] bool EnableStateHashLog(const std::string& path);
+    [[nodiscard]] bool EnableSpectatorServer(std::uint16_t port);
+    [[nodiscard]] bool EnableGpuTimers();
+    void SetBackgroundMusicEnabled(bool enabled) noexcept { m_keepMusicInBackground = enabled; }
     void Run();
 
 private:
@@ -87,9 +117,76 @@ private:
     static constexpr int TEXTURE_RESOLUTION = 16;
     static constexpr float MAX_GAME_HARDNESS = 1.0f;
     static constexpr float GRAVITY = 900.0f;
+    static constexpr int MAX_ENEMIES_LIMIT = 20;
+    static constexpr std::uint32_t ENEMIES_PER_ARCHETYPE_UNLOCK = 4;
+    static constexpr float CRATER_RADIUS_SCALE = 0.6f;     // Crater radius relative to the blast radius
+    static constexpr float CRATER_REACH_SCALE = 3.0f;      // How far below a blast the ground still gets hit
+    static constexpr int MAX_GROUND_COLLISION_PASSES = 2;  // Wall then floor in the same tick
     static constexpr std::size_t COLOR_COUNT = 25;
+    static constexpr std::chrono::milliseconds AUDIO_TUNING_TIMEOUT{250};
+    static constexpr float OVERVIEW_BLEND_RATE = 6.0f;          // How fast the view eases into and out of the overview
+    static constexpr float IMPOSTOR_MAX_SCREEN_DIAMETER = 12.0f; // Smaller entities draw as flat quads
+    static constexpr float EXPLOSION_GLOW_MAX_ZOOM = 0.75f;     // At or below this zoom explosions draw as one glow
+    static constexpr int GLOW_SPRITE_SIZE = 64;
+    static constexpr std::size_t MAX_FRAME_GRAPH_WORKERS = 3; // The tick's graph is never wider than this
+    static constexpr double BACKGROUND_POLL_INTERVAL = 0.1;   // Seconds between wakeups while minimised or unfocused
+    static constexpr float GHOST_ALPHA = 0.35f;
+    static constexpr const char* GHOST_LIBRARY_PATH = "ghosts/best_runs.ghost";
+    static constexpr std::array<const char*, ENEMY_ARCHETYPE_COUNT> BEHAVIOUR_SCRIPT_PATHS = {
+        "assets/ai/walker.bhv", "assets/ai/jumper.bhv", "assets/ai/flyer.bhv", "assets/ai/heavy.bhv"
+    };
+    
+    static constexpr std::array<const char*, 3> PLAYER_TEXTURE_PATHS = {
+        "assets/img/Gobo/Gobo0.png", "assets/img/Gobo/Gobo1.png", "assets/img/Gobo/Gobo2.png"
+    };
+    static constexpr std::array<const char*, 4> ENEMY_TEXTURE_PATHS = {
+        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother0.png",
+        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother1.png",
+        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother2.png",
+        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother3.png"
+    };
+    static constexpr std::array<const char*, 7> SOUND_PATHS = {
+        "assets/audio/explosion.wav", "assets/audio/LoseSound.wav", "assets/audio/HoverOnButtonSound.wav",
+        "assets/audio/OpenButtonSound.wav", "assets/audio/BackButtonSound.wav", "assets/audio/NO!.wav",
+        "assets/audio/Disappointing.wav"
+    };
     
     static const std::array<Color, COLOR_COUNT> COLOR_OPTIONS;
+    
+    // Moving platforms, placed relative to the main ground: x as a fraction of
+    // its width, y as the platform bottom's height above its top in window heights
+    struct PlatformLayout {
+        PlatformMotion motion;
+        float fromX, fromY, toX, toY;
+        float width;  // Fraction of the ground's width
+        float height; // Pixels
+        float period;
+        float phase;
+    };
+    static constexpr std::array<PlatformLayout, 4> PLATFORM_LAYOUTS = {{
+        {PlatformMotion::Patrol,   0.10f, 0.30f, 0.26f, 0.30f, 0.08f, 20.0f, 6.0f, 0.0f},
+        {PlatformMotion::Crusher,  0.36f, 0.55f, 0.36f, 0.00f, 0.05f, 48.0f, 4.0f, 0.0f},
+        {PlatformMotion::Patrol,   0.60f, 0.50f, 0.70f, 0.50f, 0.07f, 20.0f, 5.0f, 0.5f},
+        {PlatformMotion::Elevator, 0.80f, 0.15f, 0.80f, 0.45f, 0.06f, 20.0f, 7.0f, 0.25f}
+    }};
+    static constexpr Color CRUSHER_TINT = {150, 150, 160, 255};
+
+    // CPU-side asset data, decoded on a helper thread while the window and
+    // audio device come up; whatever LoadAssets doesn't keep is freed here
+    struct DecodedAssets {
+        DecodedAssets() = default;
+        DecodedAssets(const DecodedAssets&) = delete;
+        DecodedAssets& operator=(const DecodedAssets&) = delete;
+        ~DecodedAssets();
+
+        std::array<Image, PLAYER_TEXTURE_PATHS.size()> playerImages{};
+        std::array<Image, ENEMY_TEXTURE_PATHS.size()> enemyImages{};
+        Image groundImage{};
+        Image finishLineImage{};
+        Image iconImage{};
+        std::array<Wave, SOUND_PATHS.size()> soundWaves{};
+        std::vector<std::string> errors;
+    };
 
     // Window state
     int m_currentWindowWidth;
@@ -103,19 +200,33 @@ private:
     GameState m_currentGameState{GameState::MainMenu};
     bool m_resetGame{false};
     float m_deltaTime{0.0f};
+    float m_frameSeconds{0.0f}; // Real time of this frame; m_deltaTime may be a fixed or replayed step
     float m_gameHardness{0.5f};
-    Camera2D m_camera{};
+    Camera2D m_camera{};       // Follows Gobo; part of the simulation, enemies spawn relative to it
+    Camera2D m_renderCamera{}; // m_camera eased toward the overview, used only for drawing
+    bool m_overviewEnabled{false};
+    float m_overviewBlend{0.0f};
     
     // Audio settings
     bool m_musicEnabled{true};
     bool m_soundEnabled{true};
     float m_musicVolume{1.0f};
+    float m_sentMusicVolume{-1.0f};       // Last volume queued, so unchanged volumes aren't re-sent
+    bool m_isBackgroundMusicPaused{false};
+    bool m_keepMusicInBackground{false};  // Otherwise music stops while the window is in the background
+    
+    // Background throttling
+    bool m_isBackgrounded{false};
+    bool m_isBackgroundPausePending{false}; // The next frame presses Back for the player
     
     // UI state
     std::size_t m_selectedMainMenuOption{0};
     std::size_t m_selectedOptionsMenuOption{0};
     std::size_t m_selectedGameOverMenuOption{0};
     std::size_t m_selectedExitMenuOption{0};
+    std::size_t m_selectedPauseMenuOption{0};
+    RenderTexture2D m_frozenFrame{};   // Last world frame, shown behind the pause and game-over menus
+    bool m_isFrozenFrameValid{false};
     
     // Game settings
     int m_maxEnemies{5};
@@ -125,12 +236,17 @@ private:
     float m_enemyScale{START_TEXTURE_SCALE};
     float m_enemySpawnTimer{0.0f};
     float m_enemySpawnInterval{4.0f};
+    std::uint32_t m_enemiesSpawned{0};
     
     // Assets
     std::vector<Texture2D> m_playerTextures;
     std::vector<Texture2D> m_enemyTextures;
     Texture2D m_groundTexture{};
+    Image m_groundImage{}; // CPU copy of the ground tile for the destructible terrain
     Texture2D m_finishLineTexture{};
+    Texture2D m_glowTexture{};       // Stands in for an explosion's particles when zoomed out
+    Color m_playerImpostorColor{WHITE}; // Average sprite colours for the zoomed-out quads
+    Color m_enemyImpostorColor{WHITE};
     
     // Audio assets
     Sound m_explosionSound{};
@@ -143,39 +259,143 @@ private:
     Music m_playerRunSound{};
     Music m_backgroundMusic{};
 
-    // Game objects
-    std::unique_ptr<Player> m_player;
-    std::vector<std::unique_ptr<Enemy>> m_enemies;
-    std::vector<std::unique_ptr<Ground>> m_grounds;
-    std::unique_ptr<FinishLine> m_finishLine;
+    // Game objects (owned by the session arena, released all at once)
+    SessionArena m_sessionArena;
+    ArenaPool<Enemy> m_enemyPool{m_sessionArena};
+    Player* m_player{nullptr};
+    std::vector<Enemy*> m_enemies;
+    std::array<std::vector<Enemy*>, ENEMY_ARCHETYPE_COUNT> m_enemiesByArchetype; // Homogeneous AI batches
+    std::array<BehaviourProgram, ENEMY_ARCHETYPE_COUNT> m_behaviourPrograms; // Empty runs the built-in kernel
+    BehaviourVM m_behaviourVM;
+    std::vector<Ground*> m_grounds;   // Static level geometry; m_grounds[0] is the main ground
+    PlatformSystem m_platforms;
+    GroundGrid m_groundGrid;         // Broad phase over the grounds and platforms
+    FinishLine* m_finishLine{nullptr};
     ExplosionManager m_explosionManager;
+    ProjectileSystem m_projectiles;
+    std::vector<Circle> m_projectileTargets;      // Per-tick target list for the batched hit tests
+    std::vector<std::uint8_t> m_playerShotHits;
+    std::vector<std::uint8_t> m_enemyShotHits;    // Indexed like m_enemies
+    TerrainMask m_terrain; // Owned here rather than by the arena ground since it holds a GPU texture
+    
+    // Ghosts of the best runs, played back beside the live one
+    GhostLibrary m_ghostLibrary;
+    GhostRecorder m_ghostRecorder;
+    std::vector<GhostCursor> m_ghostCursors; // One per library run, best first
+    float m_ghostTime{0.0f};
+    StaticTileMesh m_groundMesh;     // Tiled grounds without destructible terrain
+    StaticTileMesh m_finishLineMesh;
+    LightBuffer m_lightBuffer;       // Glow from explosions and the bomb indicator
+    std::vector<std::size_t> m_enemiesToRemove;
+    
+    // Gameplay recording
+    FrameCapture m_frameCapture;
+    float m_enemyBuffTimer{0.0f};
+    
+    // Frame timing statistics (indexed by GameState, written out when the game closes)
+    std::array<LatencyHistogram, GAME_STATE_COUNT> m_frameTimeHistograms;
+    std::array<LatencyHistogram, GAME_STATE_COUNT> m_tickTimeHistograms;
+    std::array<LatencyHistogram, GAME_STATE_COUNT> m_renderTimeHistograms; // CPU side, BeginDrawing to EndDrawing
+    double m_sessionStartTime{0.0};
+    GpuTimer m_gpuTimer;             // Optional, per render pass on the GPU
+    
+    // Playing tick as a task graph, with per-task and critical-path timings for the summary
+    FrameGraph m_frameGraph;
+    std::vector<LatencyHistogram> m_frameTaskHistograms;    // Indexed like the graph's tasks
+    std::vector<std::uint64_t> m_frameTaskCriticalCounts;   // Ticks each task was on the critical path
+    LatencyHistogram m_frameCriticalPathHistogram;
+    LatencyHistogram m_frameTaskWorkHistogram;
+    LatencyHistogram m_frameGraphWallHistogram;
+    
+    // Input, determinism and crash diagnostics
+    InputFrame m_input;
+    FlightRecorder m_flightRecorder;
+    std::uint32_t m_frameIndex{0};
+    std::mt19937 m_randomGenerator;
+    std::uint32_t m_sessionSeed{0};
+    bool m_sessionStartPending{false};
+    std::vector<FlightRecord> m_replayRecords;
+    std::size_t m_replayCursor{0};
+    bool m_isReplaying{false};
+    
+    // Determinism checking (per-tick state hashes, optionally logged)
+    StateHashLog m_stateHashLog;
+    StateHasher m_terrainHasher;            // Folded with every crater, so terrain costs nothing per tick
+    StateHashRecord m_lastStateHash;
+    std::uint32_t m_sessionTick{0};
+    std::uint64_t m_randomDrawCount{0};
+    std::uint64_t m_replayExpectedHash{0};
+    bool m_replayDiverged{false};
+    
+    // Built-in benchmark scene
+    Benchmark m_benchmark;
+    bool m_exitAfterBenchmark{false};
+    int m_maxEnemiesBeforeBenchmark{0};
+    std::optional<double> m_lastBenchmarkScore;
+    
+    // Live world stream for --spectate clients
+    SpectatorServer m_spectatorServer;
     
     // Private methods - Asset management
-    [[nodiscard]] bool LoadAssets();
+    static void DecodeAssets(DecodedAssets& assets);
+    [[nodiscard]] bool LoadAssets(DecodedAssets& decoded);
     void UnloadAssets() noexcept;
+    void LoadBehaviourScripts();
     
     // Private methods - Game logic
+    void RunFrame();
     void InitializeEntities();
+    void ClearEnemies() noexcept;
+    void UpdateEnemyAI();
+    void SeedSession();
     void SpawnEnemies();
-    void UpdateGame();
+    [[nodiscard]] EnemyArchetype PickEnemyArchetype();
+    void BuildFrameGraph();
+    void UpdateCamera();
+    void UpdateDifficulty() noexcept;
+    void CheckGameOver();
+    void UpdateEnemies();
     void ResetGame();
+    void ResetSessionVariables() noexcept;
     void RestartGame();
     void SetGameOver();
+    void StartGhostSession();
+    void UpdateGhosts();
+    void SubmitGhostRun();
+    [[nodiscard]] Vector2 GetGhostOrigin() const noexcept;
     
     // Private methods - Physics
-    void ApplyGravity(Entity* entity);
+    void ApplyGravity(Entity* entity, float gravityScale = 1.0f);
     void HandleGroundCollision(Entity* entity);
+    void ResolveGroundCollision(Entity* entity, const CollisionInfo& collision);
     void HandleEnemyCollision(Enemy* enemy);
     void HandleFinishLineCollision(Enemy* enemy);
     void HandleEnemyUnderMap(Enemy* enemy);
+    void UpdateProjectiles();
     void RemoveEnemy(Enemy* enemy);
     
     // Private methods - World generation
     void CreateGrounds();
+    void LayoutWorld();
+    void LayoutPlatforms();
+    void RebuildGroundGrid();
+    void CarryEntities();
+    [[nodiscard]] const Ground* FindCrushingPlatform(const Entity* entity) const;
+    void HandlePlayerCrush();
+    void RebuildTerrain();
+    void RebuildLevelMeshes();
+    [[nodiscard]] Rectangle GetVisibleWorldArea() const noexcept;
+    [[nodiscard]] Camera2D GetOverviewCamera() const noexcept;
+    void UpdateRenderCamera(float frameSeconds);
+    void CarveExplosionCraters();
     [[nodiscard]] float GetGroundHeight() const noexcept;
+    [[nodiscard]] Vector2 GetFinishLineSize() const noexcept;
+    [[nodiscard]] float GetPlayerBaseRadius() const noexcept;
+    [[nodiscard]] Vector2 GetPlayerSpawnPosition() const noexcept;
     
     // Private methods - Collision detection
     [[nodiscard]] CollisionInfo GetGroundCollisionInfo(Entity* entity) const;
+    [[nodiscard]] CollisionInfo GetTerrainCollisionInfo(const Circle& bounds, Ground* ground) const;
     [[nodiscard]] CollisionSide GetCollisionSide(Circle circle1, Circle circle2) const;
     
     // Private methods - Input handling
@@ -185,13 +405,21 @@ private:
     void HandleOptionsMenuInput();
     void HandleGameOverMenuInput();
     void HandleExitMenuInput();
+    void HandlePauseMenuInput();
     
     // Private methods - Rendering
+    void RenderLights();
+    void DrawWorld();
+    void DrawFrozenWorld();
+    void DrawPlayer() const;
+    void DrawGhosts(const Rectangle& visibleArea) const;
+    void DrawEnemies(const Rectangle& visibleArea) const;
     void DrawMainMenu();
     void DrawControlsMenu();
     void DrawOptionsMenu();
     void DrawGameOverMenu();
     void DrawExitMenu();
+    void DrawPauseMenu();
     void DrawOptionsInstructions(float currentY, float centerX,
                             float availableWidth, int instrFontSize);
     void DrawOptionValue(std::size_t optionIndex, float valueX, float valueY, int valueFontSize, 
@@ -204,6 +432,27 @@ private:
     void CycleToPreviousBackgroundColor();
     [[nodiscard]] std::string GetColorName(Color color) const;
     
+    // Private methods - Recording
+    [[nodiscard]] static std::string MakeTimestampedPath(const char* directory, const char* prefix, const char* extension);
+    void ToggleFrameCapture();
+    void RecordFrameTiming(GameState state, double tickSeconds) noexcept;
+    void RecordFrameGraphTiming() noexcept;
+    void WriteFrameTimingSummary() const;
+    [[nodiscard]] static const char* GetGameStateName(GameState state) noexcept;
+    void InstallFlightRecorder();
+    void RecordFlightFrame(GameState state, double updateSeconds, double renderSeconds) noexcept;
+    void AdvanceReplay();
+    void UpdateStateHash();
+    [[nodiscard]] bool UpdateBenchmark();
+    void FinishBenchmark(bool completed);
+    void PublishSpectatorSnapshot();
+    
+    // Private methods - Background throttling
+    [[nodiscard]] bool IsInBackground() const noexcept;
+    void EnterBackground();
+    void LeaveBackground();
+    void WaitInBackground();
+    
     // Private methods - Utility
     [[nodiscard]] int GenerateRandomInt(int min, int max);
     template<typename T>
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "raylib.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// What a ghost shows of the player. Positions are relative to the middle of the
+// ground's top edge, so ghosts still line up after the window is resized.
+struct GhostPose {
+    Vector2 position{0.0f, 0.0f};
+    float sizeScale{1.0f};
+    std::uint8_t frame{0}; // Player animation frame
+};
+
+// A run as a byte stream of quantised poses taken every SAMPLE_INTERVAL. Each
+// sample is a control byte (animation frame and which fields changed) followed by
+// zigzag varint deltas of the fields that did, so standing still costs one byte
+// and walking about three.
+class GhostTrack {
+public:
+    // Constants
+    static constexpr float SAMPLE_INTERVAL = 1.0f / 30.0f;
+
+    void Clear() noexcept;
+    void Append(const GhostPose& pose);
+
+    // Getters
+    [[nodiscard]] std::uint32_t GetSampleCount() const noexcept { return m_sampleCount; }
+    [[nodiscard]] const std::vector<std::uint8_t>& GetBytes() const noexcept { return m_bytes; }
+    [[nodiscard]] float GetDuration() const noexcept;
+
+    // Loading; the stream is validated as it is played, not here
+    void Assign(std::vector<std::uint8_t> bytes, std::uint32_t sampleCount);
+
+private:
+    friend class GhostCursor;
+
+    // Constants
+    static constexpr float POSITION_STEPS = 4.0f; // Quarter-pixel positions
+    static constexpr float SCALE_STEPS = 256.0f;
+    static constexpr std::uint8_t FRAME_MASK = 0x03;
+    static constexpr std::uint8_t FLAG_MOVED = 1u << 2;
+    static constexpr std::uint8_t FLAG_SCALED = 1u << 3;
+
+    // A pose as it is stored
+    struct Quantised {
+        std::int32_t x{0};
+        std::int32_t y{0};
+        std::int32_t scale{0};
+        std::uint8_t frame{0};
+    };
+
+    // Member variables
+    std::vector<std::uint8_t> m_bytes;
+    std::uint32_t m_sampleCount{0};
+    Quantised m_last; // Deltas are taken from here
+
+    // Private helper methods
+    [[nodiscard]] static Quantised Quantise(const GhostPose& pose) noexcept;
+    void WriteVarint(std::int32_t value);
+};
+
+// Samples the live player into a track at the track's fixed rate
+class GhostRecorder {
+public:
+    void Start() noexcept;
+    void Stop() noexcept { m_isRecording = false; }
+    // Called every tick; appends a sample for each interval that has passed
+    void Update(float deltaTime, const GhostPose& pose);
+
+    // Getters
+    [[nodiscard]] bool IsRecording() const noexcept { return m_isRecording; }
+    [[nodiscard]] const GhostTrack& GetTrack() const noexcept { return m_track; }
+
+private:
+    // Member variables
+    GhostTrack m_track;
+    float m_time{0.0f}; // Since Start()
+    bool m_isRecording{false};
+};
+
+// Plays a track back by decoding it as time passes: the previous and next sample
+// and a read offset are all the state, so a ghost costs a few dozen bytes and a
+// varint or two per tick. The track must outlive the cursor.
+class GhostCursor {
+public:
+    explicit GhostCursor(const GhostTrack& track) noexcept;
+
+    // Moves forward to time (seconds since the run started); false once the run is over
+    bool Seek(float time) noexcept;
+
+    // Getters
+    [[nodiscard]] bool IsFinished() const noexcept { return m_isFinished; }
+    [[nodiscard]] GhostPose GetPose() const noexcept; // Interpolated between samples
+
+private:
+    // Member variables
+    const GhostTrack* m_track;
+    std::size_t m_offset{0};
+    std::uint32_t m_index{0}; // Of m_current; m_next is the sample after it
+    GhostTrack::Quantised m_current;
+    GhostTrack::Quantised m_next;
+    GhostTrack::Quantised m_decoded; // Newest sample read, the base for the next delta
+    float m_fraction{0.0f};
+    bool m_isFinished{false};
+
+    // Private helper methods
+    [[nodiscard]] bool DecodeNext(GhostTrack::Quantised& sample) noexcept;
+    [[nodiscard]] bool ReadVarint(std::int32_t& value) noexcept;
+};
+
+// A finished run worth keeping
+struct GhostRun {
+    std::int32_t killCount{0};
+    GhostTrack track;
+};
+
+// The best runs so far, best first: most kills, then the longest run
+class GhostLibrary {
+public:
+    // Constants
+    static constexpr std::size_t MAX_RUNS = 10;
+
+    // A missing file is an empty library; a damaged one is reported and ignored
+    [[nodiscard]] bool Load(const std::string& path);
+    [[nodiscard]] bool Save(const std::string& path) const;
+
+    // Keeps the run if it makes the board; returns its rank, or MAX_RUNS if it didn't
+    std::size_t Submit(GhostRun run);
+
+    // Getters
+    [[nodiscard]] std::size_t GetRunCount() const noexcept { return m_runs.size(); }
+    [[nodiscard]] const GhostRun& GetRun(std::size_t rank) const noexcept { return m_runs[rank]; }
+
+private:
+    // Constants
+    static constexpr std::array<char, 8> MAGIC = {'G', 'O', 'B', 'O', 'G', 'S', 'T', '\0'};
+    static constexpr std::uint32_t FILE_VERSION = 1;
+    static constexpr std::uint32_t MAX_TRACK_BYTES = 16u << 20; // Rejects damaged sizes before allocating
+
+    // File header, followed by runCount runs, each a RunHeader and its track bytes
+    struct Header {
+        std::array<char, 8> magic{};
+        std::uint32_t version{0};
+        std::uint32_t runCount{0};
+    };
+
+    struct RunHeader {
+        std::int32_t killCount{0};
+        std::uint32_t sampleCount{0};
+        std::uint32_t byteCount{0};
+    };
+
+    // Member variables
+    std::vector<GhostRun> m_runs;
+
+    // Private helper methods
+    [[nodiscard]] static bool IsBetter(const GhostRun& first, const GhostRun& second) noexcept;
+};
+
+} // namespace PlayAsGobo
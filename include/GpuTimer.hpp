@@ -0,0 +1,94 @@
+#pragma once
+
+#include "LatencyHistogram.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace PlayAsGobo {
+
+// Render passes timed on the GPU, in the order a world frame draws them
+enum class GpuPass : std::uint8_t {
+    Lights,    // Light buffer (quarter-res glow)
+    Ground,    // Terrain, tile meshes, platforms and the finish line
+    Sprites,   // Player, enemies and projectiles
+    Particles, // Explosions and their glow
+    Composite, // Light buffer and frozen-frame blits
+    Ui,        // Text and menus
+    Count
+};
+
+inline constexpr std::size_t GPU_PASS_COUNT = static_cast<std::size_t>(GpuPass::Count);
+
+// GPU time per render pass from GL timestamp queries. A timestamp goes down at
+// every pass boundary and the time between two of them is charged to the pass
+// that started at the first. Results are read a few frames later, and only once
+// the driver says they are available, so timing never stalls the pipeline;
+// frames still in flight when their slot comes round again are dropped.
+//
+// The rlgl batch is flushed at each boundary so batched quads are charged to
+// the right pass, which costs a few extra draw calls while timing is enabled.
+// A pass that starves the GPU also picks up the CPU time until the next one is
+// submitted, so compare the frame total with the CPU render time.
+class GpuTimer {
+public:
+    // Constructor
+    GpuTimer() = default;
+
+    // Disable copy and move operations (owns GL query objects)
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+    GpuTimer(GpuTimer&&) = delete;
+    GpuTimer& operator=(GpuTimer&&) = delete;
+
+    // Destructor
+    ~GpuTimer();
+
+    // Lifecycle (requires a current GL context); false when the driver has no timer queries
+    [[nodiscard]] bool Start();
+    void Stop() noexcept;
+
+    // Per frame: BeginFrame() after BeginDrawing(), BeginPass() whenever the pass
+    // changes (passes may repeat), EndFrame() right before EndDrawing()
+    void BeginFrame();
+    void BeginPass(GpuPass pass);
+    void EndFrame();
+
+    // Getters
+    [[nodiscard]] bool IsRunning() const noexcept { return m_isRunning; }
+    [[nodiscard]] const LatencyHistogram& GetPassHistogram(GpuPass pass) const noexcept {
+        return m_passHistograms[static_cast<std::size_t>(pass)];
+    }
+    [[nodiscard]] const LatencyHistogram& GetFrameHistogram() const noexcept { return m_frameHistogram; }
+    [[nodiscard]] std::uint64_t GetDroppedFrameCount() const noexcept { return m_droppedFrames; }
+    [[nodiscard]] static const char* GetPassName(GpuPass pass) noexcept;
+
+private:
+    // Constants
+    static constexpr std::size_t FRAME_LATENCY = 4;        // Frames a result gets before its slot is reused
+    static constexpr std::size_t MAX_MARKS_PER_FRAME = 16; // Pass boundaries plus the frame end
+
+    // Queries issued during one frame, in submission order
+    struct FrameSlot {
+        std::array<unsigned int, MAX_MARKS_PER_FRAME> queries{};
+        std::array<GpuPass, MAX_MARKS_PER_FRAME> passes{}; // Pass starting at each mark
+        std::size_t markCount{0};
+        bool isPending{false};
+    };
+
+    // Member variables
+    std::array<FrameSlot, FRAME_LATENCY> m_slots{};
+    std::size_t m_currentSlot{0}; // Also the oldest slot, as they are reused round-robin
+    bool m_isRunning{false};
+    bool m_isInFrame{false};
+    std::array<LatencyHistogram, GPU_PASS_COUNT> m_passHistograms;
+    LatencyHistogram m_frameHistogram;
+    std::uint64_t m_droppedFrames{0};
+
+    // Private helper methods
+    void Mark(GpuPass pass);
+    [[nodiscard]] bool TryCollect(FrameSlot& slot);
+    void CollectAvailable();
+};
+
+} // namespace PlayAsGobo
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "raylib.h"
+#include "StaticTileMesh.hpp"
 #include <cmath>
 #include <cstdint>
+#include <vector>
 
 namespace PlayAsGobo {
 
-// Forward declaration to avoid duplication
+// Forward declarations to avoid duplication
 struct Circle;
+class TerrainMask;
 
 class Ground {
 public:
@@ -42,8 +45,13 @@ public:
     [[nodiscard]] Vector2 GetSize() const noexcept { return {m_bounds.width, m_bounds.height}; }
     [[nodiscard]] Vector2 GetCenter() const noexcept;
     [[nodiscard]] bool HasTexture() const noexcept { return m_hasTexture; }
+    [[nodiscard]] const Texture2D& GetTexture() const noexcept { return m_texture; }
     [[nodiscard]] Color GetTintColor() const noexcept { return m_tintColor; }
     [[nodiscard]] float GetArea() const noexcept { return m_bounds.width * m_bounds.height; }
+    [[nodiscard]] const TerrainMask* GetTerrainMask() const noexcept { return m_terrainMask; }
+    [[nodiscard]] bool HasReadyTerrain() const noexcept;
+    [[nodiscard]] Vector2 GetDisplacement() const noexcept { return m_displacement; } // Of the last MoveTo
+    [[nodiscard]] bool IsOneWay() const noexcept { return m_isOneWay; }
     
     // Setters with validation
     void SetPosition(float x, float y);
@@ -54,10 +62,13 @@ public:
     void SetTexture(const Texture2D& groundTexture);
     void SetTintColor(Color color) noexcept { m_tintColor = color; }
     void RemoveTexture() noexcept;
+    void SetTerrainMask(const TerrainMask* terrainMask) noexcept { m_terrainMask = terrainMask; }
+    void SetOneWay(bool isOneWay) noexcept { m_isOneWay = isOneWay; } // Only lands things from above
     
     // Movement and transformation
     void Move(float deltaX, float deltaY) noexcept;
     void Move(Vector2 delta) noexcept;
+    void MoveTo(Vector2 position) noexcept; // Kinematic step; remembers the displacement for carrying
     void Scale(float factor);
     void Scale(float factorX, float factorY);
     
@@ -72,6 +83,7 @@ public:
     void Draw() const;
     void DrawOutline(Color outlineColor = BLACK, float thickness = 1.0f) const;
     void DrawWithOffset(Vector2 offset) const;
+    void CollectTiles(std::vector<StaticTile>& tiles) const; // Textured tiles for baking into a StaticTileMesh
 
 private:
     // Constants
@@ -85,6 +97,9 @@ private:
     Texture2D m_texture{};
     Color m_tintColor{DEFAULT_COLOR};
     bool m_hasTexture{false};
+    const TerrainMask* m_terrainMask{nullptr}; // Non-owning; destructible shape and pixels when set
+    Vector2 m_displacement{0.0f, 0.0f};
+    bool m_isOneWay{false};
     
     // Private helper methods
     void ValidateDimensions(float width, float height) const;
@@ -93,6 +108,8 @@ private:
     void DrawSolidGround() const;
     void CalculateTileLayout(float textureWidth, float textureHeight,
                            std::int32_t& tilesX, std::int32_t& tilesY) const;
+    [[nodiscard]] bool ComputeTile(float textureWidth, float textureHeight, std::int32_t tileX, std::int32_t tileY,
+                                   Rectangle& destRect, Rectangle& sourceRect) const noexcept;
     void DrawTile(float textureWidth, float textureHeight,
                  std::int32_t tileX, std::int32_t tileY) const;
     Rectangle CalculateClippedDestRect(const Rectangle& destRect) const noexcept;
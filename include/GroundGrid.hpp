@@ -0,0 +1,109 @@
+#pragma once
+
+#include "raylib.h"
+#include "Ground.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Uniform-grid broad phase over ground bounds. Every ground remembers the range
+// of cells it covers; Refit() re-reads its bounds and only touches the cell lists
+// when that range changed, so a moving platform costs a few compares per tick
+// until it crosses a cell edge. Things outside the area land in the edge cells,
+// so queries stay exact. Queries never modify the grid and can run concurrently.
+class GroundGrid {
+public:
+    using Proxy = std::uint32_t;
+
+    // Empties the grid and covers area with square cells
+    void Reset(const Rectangle& area, float cellSize = DEFAULT_CELL_SIZE);
+
+    // Grounds must outlive their proxies; a Reset() drops them all
+    Proxy Insert(Ground* ground);
+    // Returns true when the ground moved into a different range of cells
+    bool Refit(Proxy proxy);
+
+    // visit(Ground*) for every ground whose cells overlap area, each once,
+    // in a fixed order; returning true from visit stops the query
+    template<typename Visitor>
+    void Query(const Rectangle& area, Visitor&& visit) const;
+    // Same, for grounds whose cells contain point
+    template<typename Visitor>
+    void QueryPoint(Vector2 point, Visitor&& visit) const;
+
+    // Getters
+    [[nodiscard]] std::size_t GetGroundCount() const noexcept { return m_proxies.size(); }
+    [[nodiscard]] std::uint64_t GetCellChangeCount() const noexcept { return m_cellChangeCount; }
+
+private:
+    // Constants
+    static constexpr float DEFAULT_CELL_SIZE = 128.0f;
+
+    struct CellRange {
+        std::int32_t firstX{0};
+        std::int32_t firstY{0};
+        std::int32_t lastX{-1};
+        std::int32_t lastY{-1};
+
+        [[nodiscard]] bool operator==(const CellRange& other) const noexcept {
+            return firstX == other.firstX && firstY == other.firstY &&
+                   lastX == other.lastX && lastY == other.lastY;
+        }
+    };
+
+    struct ProxyData {
+        Ground* ground{nullptr};
+        CellRange cells;
+    };
+
+    // Member variables
+    Rectangle m_area{0.0f, 0.0f, 0.0f, 0.0f};
+    float m_inverseCellSize{1.0f / DEFAULT_CELL_SIZE};
+    std::int32_t m_columns{0};
+    std::int32_t m_rows{0};
+    std::vector<std::vector<Proxy>> m_cells; // Row-major
+    std::vector<ProxyData> m_proxies;
+    std::uint64_t m_cellChangeCount{0};
+
+    // Private helper methods
+    [[nodiscard]] CellRange GetCellRange(const Rectangle& bounds) const noexcept;
+    [[nodiscard]] std::int32_t GetColumn(float x) const noexcept;
+    [[nodiscard]] std::int32_t GetRow(float y) const noexcept;
+    void AddToCells(Proxy proxy, const CellRange& cells);
+    void RemoveFromCells(Proxy proxy, const CellRange& cells) noexcept;
+};
+
+template<typename Visitor>
+void GroundGrid::Query(const Rectangle& area, Visitor&& visit) const {
+    if (m_cells.empty()) return;
+
+    const CellRange range = GetCellRange(area);
+    for (std::int32_t row = range.firstY; row <= range.lastY; ++row) {
+        for (std::int32_t column = range.firstX; column <= range.lastX; ++column) {
+            for (const Proxy proxy : m_cells[static_cast<std::size_t>(row * m_columns + column)]) {
+                // A ground spanning several of these cells is only reported from the
+                // first of them, which keeps queries free of any visited marks
+                const CellRange& cells = m_proxies[proxy].cells;
+                if (column != std::max(range.firstX, cells.firstX) || row != std::max(range.firstY, cells.firstY)) {
+                    continue;
+                }
+                if (visit(m_proxies[proxy].ground)) return;
+            }
+        }
+    }
+}
+
+template<typename Visitor>
+void GroundGrid::QueryPoint(Vector2 point, Visitor&& visit) const {
+    if (m_cells.empty()) return;
+
+    const std::size_t cell = static_cast<std::size_t>(GetRow(point.y) * m_columns + GetColumn(point.x));
+    for (const Proxy proxy : m_cells[cell]) {
+        if (visit(m_proxies[proxy].ground)) return;
+    }
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PlayAsGobo {
+
+// Gameplay buttons, one bit each so a frame of input fits in two bytes
+enum class InputButton : std::uint8_t {
+    MoveLeft  = 1u << 0,
+    MoveRight = 1u << 1,
+    Bomb      = 1u << 2,
+    Back      = 1u << 3,
+    Shoot     = 1u << 4
+};
+
+// Gameplay input sampled once per frame. Simulation code reads this instead of
+// polling the keyboard so recorded frames can be fed back in for replays.
+struct InputFrame {
+    std::uint8_t held{0};
+    std::uint8_t pressed{0};
+
+    [[nodiscard]] bool IsDown(InputButton button) const noexcept {
+        return (held & static_cast<std::uint8_t>(button)) != 0;
+    }
+
+    [[nodiscard]] bool WasPressed(InputButton button) const noexcept {
+        return (pressed & static_cast<std::uint8_t>(button)) != 0;
+    }
+
+    // Reads the current keyboard state through raylib
+    [[nodiscard]] static InputFrame Sample() noexcept;
+};
+
+} // namespace PlayAsGobo
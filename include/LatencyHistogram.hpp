@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Fixed-memory log-linear (HDR-style) histogram of durations in microseconds.
+// Values below 256 us are exact; above that every power-of-two range is split
+// into 128 buckets, so any reported value is within 1/128 (< 0.8%) of the truth.
+// Covers 0 us to 60 s in ~10 KB regardless of how many samples are recorded.
+class LatencyHistogram {
+public:
+    // Constructor
+    LatencyHistogram();
+
+    // Copy and move operations are cheap enough to keep defaulted
+    LatencyHistogram(const LatencyHistogram&) = default;
+    LatencyHistogram& operator=(const LatencyHistogram&) = default;
+    LatencyHistogram(LatencyHistogram&&) = default;
+    LatencyHistogram& operator=(LatencyHistogram&&) = default;
+
+    // Destructor
+    ~LatencyHistogram() = default;
+
+    // Recording
+    void RecordSeconds(double seconds) noexcept;
+    void RecordMicroseconds(std::uint64_t microseconds) noexcept;
+    void Merge(const LatencyHistogram& other) noexcept;
+    void Reset() noexcept;
+
+    // Queries
+    [[nodiscard]] std::uint64_t GetTotalCount() const noexcept { return m_totalCount; }
+    [[nodiscard]] std::uint64_t GetMaxMicroseconds() const noexcept { return m_maxValue; }
+    [[nodiscard]] std::uint64_t GetMinMicroseconds() const noexcept;
+    [[nodiscard]] double GetMeanMicroseconds() const noexcept;
+    [[nodiscard]] std::uint64_t GetPercentileMicroseconds(double percentile) const;
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_totalCount == 0; }
+
+private:
+    // Constants
+    static constexpr std::uint32_t SUB_BUCKET_BITS = 8;
+    static constexpr std::uint64_t LINEAR_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+    static constexpr std::uint64_t SUB_BUCKET_HALF = LINEAR_BUCKET_COUNT / 2;
+    static constexpr std::uint64_t MAX_TRACKABLE_MICROSECONDS = 60ull * 1000 * 1000;
+
+    // Member variables
+    std::vector<std::uint32_t> m_counts;
+    std::uint64_t m_totalCount{0};
+    std::uint64_t m_minValue{0};
+    std::uint64_t m_maxValue{0};
+    double m_sum{0.0};
+
+    // Private helper methods
+    [[nodiscard]] static std::size_t GetBucketIndex(std::uint64_t value) noexcept;
+    [[nodiscard]] static std::uint64_t GetBucketUpperBound(std::size_t index) noexcept;
+    [[nodiscard]] static std::uint32_t GetMostSignificantBit(std::uint64_t value) noexcept;
+};
+
+} // namespace PlayAsGobo
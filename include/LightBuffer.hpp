@@ -0,0 +1,63 @@
+#pragma once
+
+#include "raylib.h"
+#include "QuadWriter.hpp"
+#include <array>
+
+namespace PlayAsGobo {
+
+// Quarter-resolution additive light buffer. Emissive sources are splatted
+// into it as soft sprites, blurred with a couple of Kawase passes and added
+// over the frame as one full-screen quad, so glow costs the same however
+// many lights overlap and whatever the window size.
+class LightBuffer {
+public:
+    // Constructor
+    LightBuffer() = default;
+
+    // Disable copy and move operations (owns GPU render targets)
+    LightBuffer(const LightBuffer&) = delete;
+    LightBuffer& operator=(const LightBuffer&) = delete;
+    LightBuffer(LightBuffer&&) = delete;
+    LightBuffer& operator=(LightBuffer&&) = delete;
+
+    // Destructor
+    ~LightBuffer();
+
+    // Sizes the targets for the window (requires a current GL context); on
+    // failure the buffer stays unready and every other call does nothing
+    [[nodiscard]] bool Resize(int screenWidth, int screenHeight);
+    void Unload() noexcept;
+
+    // Accumulation through camera; must not be nested in another texture
+    // mode, and AddLight is only valid between Begin and End
+    void Begin(const Camera2D& camera);
+    void AddLight(Vector2 position, float radius, Color color); // Alpha scales the intensity
+    void End();
+
+    // Adds the blurred lights over whatever was drawn, in screen space
+    void Composite() const;
+
+    // Getters
+    [[nodiscard]] bool IsReady() const noexcept { return m_targets[0].id != 0 && m_targets[1].id != 0; }
+
+private:
+    // Constants
+    static constexpr int DOWNSCALE = 4;
+    static constexpr int SPRITE_SIZE = 64;
+    static constexpr std::array<float, 2> BLUR_OFFSETS = {0.5f, 1.5f}; // Texels, one pass each
+
+    // Member variables
+    std::array<RenderTexture2D, 2> m_targets{}; // Ping-pong; the lights end up in the first
+    Texture2D m_sprite{};
+    QuadWriter m_quads; // Open between Begin and End
+    int m_screenWidth{0};
+    int m_screenHeight{0};
+    bool m_isAccumulating{false};
+    bool m_hasLights{false}; // Frames without lights skip the blur and the composite
+
+    // Private helper methods
+    void BlurPass(const RenderTexture2D& source, const RenderTexture2D& destination, float offset) const;
+};
+
+} // namespace PlayAsGobo
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "raylib.h"
+#include "Ground.hpp"
+#include "GroundGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+enum class PlatformMotion : std::uint8_t {
+    Patrol,   // Back and forth at a steady speed
+    Elevator, // Eases between the ends and waits at each
+    Crusher   // Waits at `from`, slams to `to`, holds, then rises slowly
+};
+
+struct PlatformPath {
+    PlatformMotion motion{PlatformMotion::Patrol};
+    Vector2 from{0.0f, 0.0f}; // Top-left corner at either end
+    Vector2 to{0.0f, 0.0f};
+    float period{4.0f};       // Seconds for a full cycle
+    float phase{0.0f};        // 0-1 offset into the cycle
+};
+
+// Kinematic platforms. Each one is a Ground whose position is a function of
+// the session time, so platforms never drift and replays match. After moving,
+// a platform's grid proxy is refitted in place; static grounds are untouched.
+class PlatformSystem {
+public:
+    // Platform grounds are owned elsewhere (the session arena)
+    void Clear() noexcept;
+    void Add(Ground* ground, const PlatformPath& path);
+    void SetPath(std::size_t index, const PlatformPath& path) noexcept; // Layout changes; the clock keeps running
+    void ResetTime() noexcept { m_time = 0.0f; }
+
+    // Inserts every platform into grid, which must have been Reset() with the rest of the level
+    void Register(GroundGrid& grid);
+    // Advances the clock and moves every platform to its new spot
+    void Update(float deltaTime, GroundGrid& grid);
+
+    // Rendering: platforms overlapping visibleArea (world space)
+    void Draw(const Rectangle& visibleArea) const;
+
+    // Getters
+    [[nodiscard]] std::size_t GetCount() const noexcept { return m_platforms.size(); }
+    [[nodiscard]] const Ground* GetGround(std::size_t index) const noexcept { return m_platforms[index].ground; }
+    [[nodiscard]] float GetTime() const noexcept { return m_time; }
+
+private:
+    // Constants
+    static constexpr float ELEVATOR_WAIT = 0.2f;      // Share of the cycle spent at each end
+    static constexpr float CRUSHER_RAISED_END = 0.45f; // Cycle fractions where each crusher stage ends
+    static constexpr float CRUSHER_FALL_END = 0.55f;
+    static constexpr float CRUSHER_LOWERED_END = 0.7f;
+
+    struct Platform {
+        Ground* ground{nullptr};
+        PlatformPath path;
+        GroundGrid::Proxy proxy{0};
+    };
+
+    // Member variables
+    std::vector<Platform> m_platforms;
+    float m_time{0.0f};
+
+    // Private helper methods
+    [[nodiscard]] Vector2 GetPosition(const PlatformPath& path) const noexcept;
+    [[nodiscard]] static float GetTravel(PlatformMotion motion, float cycle) noexcept; // 0 at from, 1 at to
+};
+
+} // namespace PlayAsGobo
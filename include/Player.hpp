@@ -2,6 +2,8 @@
 
 #include "Entity.hpp"
 #include "Explosion.hpp"
+#include "InputFrame.hpp"
+#include "ProjectileSystem.hpp"
 #include <vector>
 #include <cmath>
 #include <cstdint>
@@ -33,6 +35,8 @@ public:
     [[nodiscard]] bool IsMoving() const noexcept { return m_isMoving; }
     [[nodiscard]] float GetMoveSpeed() const noexcept { return m_moveSpeed; }
     [[nodiscard]] const Music& GetWalkSound() const noexcept { return m_walkSound; }
+    [[nodiscard]] std::int32_t GetCurrentFrame() const noexcept { return static_cast<std::int32_t>(m_currentFrame); }
+    [[nodiscard]] bool IsFacingLeft() const noexcept { return m_isFacingLeft; }
     
     // Game actions
     void IncrementKillCount() noexcept { ++m_killCount; }
@@ -41,19 +45,22 @@ public:
     void GrowLarger();
     void ShrinkSize();
     void ResetToOriginalSize() noexcept;
+    void Respawn(float x, float y) noexcept;
     
     // Input and game logic
-    void HandleInput(float deltaTime, const Rectangle& groundBounds,
-                    ExplosionManager& explosionManager,
+    void HandleInput(const InputFrame& input, float deltaTime, const Rectangle& groundBounds,
+                    ExplosionManager& explosionManager, ProjectileSystem& projectiles,
                     const Sound& explosionSound, bool soundEnabled);
 
     void SetWalkSound(const Music& sound) noexcept { m_walkSound = sound; }
+    void StopWalkSound() noexcept;
     
     // Override virtual methods from Entity
     void Update(float deltaTime) override;
     void Draw(std::int32_t textureResolution, 
              std::int32_t windowHeight, 
              std::int32_t windowWidth) const override;
+    void AddLights(LightBuffer& lights) const; // Pulsing glow while a bomb is ready
 
 private:
     // Constants
@@ -65,6 +72,11 @@ private:
     static constexpr float ANIMATION_INTERVAL = 0.2f;
     static constexpr float BOMB_TEXT_PULSE_SPEED = 4.0f;
     static constexpr float BOMB_GLOW_OPACITY = 0.8f;
+    static constexpr float BOMB_GLOW_RADIUS_SCALE = 0.8f;
+    static constexpr float SHOT_COOLDOWN = 0.2f;
+    static constexpr float SHOT_SPEED = 700.0f;
+    static constexpr float SHOT_LIFETIME = 0.3f; // Short range: about 210 px
+    static constexpr float SHOT_RADIUS = 5.0f;
     
     // Animation frame indices
     enum class AnimationFrame : std::uint8_t {
@@ -74,21 +86,27 @@ private:
     };
     
     // Member variables
-    std::vector<Texture2D> m_textures;
+    const std::vector<Texture2D>* m_textures; // Shared with Game, must outlive the player
     Music m_walkSound;
     float m_moveSpeed;
     float m_originalRadius;
+    float m_startScale;
     float m_sizeScale;
     float m_animationTimer{0.0f};
+    float m_shotCooldown{0.0f};
     std::int32_t m_killCount{0};
     AnimationFrame m_currentFrame{AnimationFrame::Standing};
     bool m_isMoving{false};
+    bool m_isWalkSoundPlaying{false}; // As last requested from the audio thread
+    bool m_isFacingLeft{false};
     bool m_canUseBomb{false};
     
     // Private helper methods
     void UpdateAnimation(float deltaTime);
-    void HandleMovementInput(float deltaTime, const Rectangle& groundBounds, bool soundEnabled);
-    void HandleBombInput(ExplosionManager& explosionManager, const Sound& explosionSound, bool soundEnabled);
+    void HandleMovementInput(const InputFrame& input, float deltaTime, const Rectangle& groundBounds, bool soundEnabled);
+    void HandleBombInput(const InputFrame& input, ExplosionManager& explosionManager,
+                         const Sound& explosionSound, bool soundEnabled);
+    void HandleShootInput(const InputFrame& input, float deltaTime, ProjectileSystem& projectiles) noexcept;
     void UpdateRadius() noexcept;
     void DrawBombIndicator(std::int32_t windowHeight) const;
     void ValidateTextures() const;
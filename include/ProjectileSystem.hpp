@@ -0,0 +1,86 @@
+#pragma once
+
+#include "raylib.h"
+#include "Entity.hpp"
+#include "GroundGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+enum class ProjectileOwner : std::uint8_t {
+    Player, // Gobo's shots, hit enemies
+    Enemy   // Thrown at Gobo
+};
+
+// Fixed-capacity projectile pool stored as parallel arrays. Integration,
+// collision and drawing are each one loop over the live range, so tens of
+// thousands of projectiles stay cheap; dead ones are swapped out of the live
+// range once per tick, so the pool never allocates after construction.
+class ProjectileSystem {
+public:
+    // Constructor
+    ProjectileSystem();
+
+    // Disable copy and move operations (owns a GPU texture)
+    ProjectileSystem(const ProjectileSystem&) = delete;
+    ProjectileSystem& operator=(const ProjectileSystem&) = delete;
+    ProjectileSystem(ProjectileSystem&&) = delete;
+    ProjectileSystem& operator=(ProjectileSystem&&) = delete;
+
+    // Destructor
+    ~ProjectileSystem();
+
+    // Assets (require a current GL context); without the sprite projectiles draw as squares
+    void LoadSprite();
+    void UnloadSprite() noexcept;
+
+    // Spawning; returns false and drops the projectile when the pool is full
+    bool Spawn(ProjectileOwner owner, Vector2 position, Vector2 velocity,
+               float radius, float lifetime, float gravityScale = 0.0f) noexcept;
+    void Clear() noexcept { m_count = 0; }
+
+    // Simulation, once per tick in this order; collisions only mark projectiles
+    // dead, RemoveDead() compacts the live range afterwards
+    void Integrate(float deltaTime, float gravity) noexcept;
+    void CollideWithGround(const GroundGrid& grounds) noexcept;
+    // Sets hitFlags[i] for every target i struck by a projectile of owner and
+    // returns the number of hits; each projectile hits at most one target
+    std::size_t CollideWithTargets(ProjectileOwner owner, const std::vector<Circle>& targets,
+                                   std::vector<std::uint8_t>& hitFlags) noexcept;
+    void RemoveDead() noexcept;
+
+    // Rendering: one batch for every projectile inside visibleArea (world space)
+    void Draw(const Rectangle& visibleArea) const;
+
+    // Getters
+    [[nodiscard]] std::size_t GetCount() const noexcept { return m_count; }
+    [[nodiscard]] static constexpr std::size_t GetCapacity() noexcept { return CAPACITY; }
+    [[nodiscard]] Vector2 GetPosition(std::size_t index) const noexcept { return {m_x[index], m_y[index]}; }
+    [[nodiscard]] ProjectileOwner GetOwner(std::size_t index) const noexcept { return m_owner[index]; }
+
+private:
+    // Constants
+    static constexpr std::size_t CAPACITY = 32768;
+    static constexpr int SPRITE_SIZE = 16;
+    static constexpr Color PLAYER_SHOT_COLOR = {255, 240, 120, 255};
+    static constexpr Color ENEMY_SHOT_COLOR = {230, 60, 40, 255};
+
+    // Member variables (one array per field, m_count of each live)
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_velocityX;
+    std::vector<float> m_velocityY;
+    std::vector<float> m_radius;
+    std::vector<float> m_life;
+    std::vector<float> m_gravityScale;
+    std::vector<ProjectileOwner> m_owner;
+    std::size_t m_count{0};
+    Texture2D m_sprite{};
+
+    // Private helper methods
+    void MoveProjectile(std::size_t from, std::size_t to) noexcept;
+};
+
+} // namespace PlayAsGobo
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "raylib.h"
+#include "rlgl.h"
+#include <cstring>
+
+namespace PlayAsGobo {
+
+// Writes axis-aligned squares, each showing the whole current texture, straight
+// into the rlgl batch through the vendored rlReserveVertices(): one limit check
+// per reservation rather than a dozen function calls per quad. Use between
+// rlBegin(RL_QUADS) and rlEnd(), with nothing else submitting vertices until
+// Finish(). Without the bulk API (OpenGL 1.1, an rlPushMatrix() transform, a
+// system raylib) it falls back to per-vertex calls.
+class QuadWriter {
+public:
+    // Constructor
+    QuadWriter() = default;
+
+    // Disable copy and move operations (points into the active batch)
+    QuadWriter(const QuadWriter&) = delete;
+    QuadWriter& operator=(const QuadWriter&) = delete;
+    QuadWriter(QuadWriter&&) = delete;
+    QuadWriter& operator=(QuadWriter&&) = delete;
+
+    // Destructor
+    ~QuadWriter() { Finish(); }
+
+    void Begin() noexcept;
+    void Add(Vector2 center, float halfSize, Color color) noexcept;
+    // Hands what was written to the batch; must come before rlEnd()
+    void Finish() noexcept;
+
+private:
+    // Constants
+    static constexpr int RESERVE_REQUEST = 1 << 20; // More than any batch holds, so each grant is all that fits
+
+    // Member variables
+    float* m_vertices{nullptr};
+    float* m_texcoords{nullptr};
+    unsigned char* m_colors{nullptr};
+    int m_capacity{0}; // Vertices granted by the last reservation
+    int m_used{0};
+    bool m_isActive{false};
+    bool m_useFallback{false};
+
+    // Private helper methods
+    void Reserve() noexcept;
+    static void AddFallback(Vector2 center, float halfSize, Color color) noexcept;
+};
+
+inline void QuadWriter::Add(Vector2 center, float halfSize, Color color) noexcept {
+    if (m_used + 4 > m_capacity) {
+        Reserve();
+        if (m_useFallback) {
+            AddFallback(center, halfSize, color);
+            return;
+        }
+    }
+
+    // Same corner order and texture coordinates as raylib's own quads
+    const float left = center.x - halfSize;
+    const float top = center.y - halfSize;
+    const float right = center.x + halfSize;
+    const float bottom = center.y + halfSize;
+
+    float* vertices = m_vertices + 3 * m_used;
+    vertices[0] = left;
+    vertices[1] = top;
+    vertices[3] = left;
+    vertices[4] = bottom;
+    vertices[6] = right;
+    vertices[7] = bottom;
+    vertices[9] = right;
+    vertices[10] = top;
+
+    static constexpr float TEXCOORDS[8] = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f};
+    std::memcpy(m_texcoords + 2 * m_used, TEXCOORDS, sizeof(TEXCOORDS));
+
+    static_assert(sizeof(Color) == 4, "Colors are copied straight into the RGBA8 array");
+    unsigned char* colors = m_colors + 4 * m_used;
+    for (int corner = 0; corner < 4; ++corner) {
+        std::memcpy(colors + 4 * corner, &color, sizeof(Color));
+    }
+
+    m_used += 4;
+}
+
+} // namespace PlayAsGobo
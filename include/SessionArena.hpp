@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Bump allocator backing every per-session object (player, grounds, finish line,
+// enemies). The buffer is allocated once and Reset() releases everything in O(1).
+// Objects created here never have their destructors run on Reset(), so they must
+// not own heap resources.
+class SessionArena {
+public:
+    // Constructor
+    explicit SessionArena(std::size_t capacityBytes = DEFAULT_CAPACITY);
+
+    // Disable copy and move operations (pointers into the arena must stay valid)
+    SessionArena(const SessionArena&) = delete;
+    SessionArena& operator=(const SessionArena&) = delete;
+    SessionArena(SessionArena&&) = delete;
+    SessionArena& operator=(SessionArena&&) = delete;
+
+    // Destructor
+    ~SessionArena() = default;
+
+    // Allocation
+    [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment);
+
+    template<typename T, typename... Args>
+    [[nodiscard]] T* Create(Args&&... args) {
+        void* memory = Allocate(sizeof(T), alignof(T));
+        return ::new (memory) T(std::forward<Args>(args)...);
+    }
+
+    // Releases every allocation at once
+    void Reset() noexcept { m_offset = 0; }
+
+    // State queries
+    [[nodiscard]] std::size_t GetCapacity() const noexcept { return m_capacity; }
+    [[nodiscard]] std::size_t GetUsedBytes() const noexcept { return m_offset; }
+    [[nodiscard]] std::size_t GetHighWaterMark() const noexcept { return m_highWaterMark; }
+
+private:
+    // Constants
+    static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;
+    static constexpr std::size_t MIN_CAPACITY = 1024;
+
+    // Member variables
+    std::unique_ptr<std::byte[]> m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_offset{0};
+    std::size_t m_highWaterMark{0};
+
+    // Private helper methods
+    void ValidateCapacity(std::size_t capacityBytes) const;
+};
+
+// Recycles fixed-size slots of one type inside a SessionArena, so objects that
+// come and go during a session (enemies) do not keep bumping the arena.
+template<typename T>
+class ArenaPool {
+public:
+    // Constructor
+    explicit ArenaPool(SessionArena& arena) : m_arena(arena) {}
+
+    // Disable copy operations
+    ArenaPool(const ArenaPool&) = delete;
+    ArenaPool& operator=(const ArenaPool&) = delete;
+
+    // Destructor
+    ~ArenaPool() = default;
+
+    // Object management
+    template<typename... Args>
+    [[nodiscard]] T* Acquire(Args&&... args) {
+        if (m_freeSlots.empty()) {
+            return m_arena.Create<T>(std::forward<Args>(args)...);
+        }
+
+        void* slot = m_freeSlots.back();
+        T* object = ::new (slot) T(std::forward<Args>(args)...);
+        m_freeSlots.pop_back();
+        return object;
+    }
+
+    void Release(T* object) {
+        if (!object) return;
+
+        object->~T();
+        m_freeSlots.push_back(object);
+    }
+
+    // Forget all slots; call together with SessionArena::Reset()
+    void Reset() noexcept { m_freeSlots.clear(); }
+
+    void Reserve(std::size_t count) { m_freeSlots.reserve(count); }
+
+    // State queries
+    [[nodiscard]] std::size_t GetFreeSlotCount() const noexcept { return m_freeSlots.size(); }
+
+private:
+    SessionArena& m_arena;
+    std::vector<void*> m_freeSlots;
+};
+
+} // namespace PlayAsGobo
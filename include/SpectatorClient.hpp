@@ -0,0 +1,73 @@
+#pragma once
+
+#include "raylib.h"
+#include "SpectatorProtocol.hpp"
+#include "UdpSocket.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Read-only viewer for a game started with --broadcast. Runs in its own
+// process and window, decodes the snapshot stream and draws the world
+// interpolated between the two newest snapshots.
+class SpectatorClient {
+public:
+    // Constructor
+    SpectatorClient() = default;
+
+    // Disable copy and move operations (owns a window, textures and a socket)
+    SpectatorClient(const SpectatorClient&) = delete;
+    SpectatorClient& operator=(const SpectatorClient&) = delete;
+    SpectatorClient(SpectatorClient&&) = delete;
+    SpectatorClient& operator=(SpectatorClient&&) = delete;
+
+    // Destructor
+    ~SpectatorClient();
+
+    // Blocks until the window is closed; returns the process exit code
+    [[nodiscard]] int Run(std::uint16_t serverPort);
+
+private:
+    // Constants
+    static constexpr std::int32_t WINDOW_WIDTH = 960;
+    static constexpr std::int32_t WINDOW_HEIGHT = 540;
+    static constexpr std::size_t HISTORY_SIZE = 64;
+    static constexpr float SNAPSHOT_INTERVAL = 3.0f / 60.0f; // Matches the server's send rate
+    static constexpr float HELLO_INTERVAL = 0.5f;
+    static constexpr float STATS_INTERVAL = 1.0f;
+    static constexpr std::int32_t TEXTURE_RESOLUTION = 16;
+
+    // Member variables
+    UdpSocket m_socket;
+    UdpEndpoint m_server;
+    std::array<SpectatorProtocol::Snapshot, HISTORY_SIZE> m_history;
+    const SpectatorProtocol::Snapshot* m_previous{nullptr};
+    const SpectatorProtocol::Snapshot* m_latest{nullptr};
+    float m_sinceLatest{0.0f};
+    float m_sinceHello{HELLO_INTERVAL};
+    std::vector<std::uint8_t> m_receiveBuffer;
+    std::vector<std::uint8_t> m_sendBuffer;
+    std::vector<Texture2D> m_playerTextures;
+    std::vector<Texture2D> m_enemyTextures;
+    std::size_t m_bytesThisSecond{0};
+    std::size_t m_snapshotsThisSecond{0};
+    float m_statsTimer{0.0f};
+    float m_bytesPerSecond{0.0f};
+    std::size_t m_snapshotsPerSecond{0};
+    std::size_t m_lastSnapshotSize{0};
+
+    // Private helper methods
+    void LoadTextures();
+    void UnloadTextures() noexcept;
+    void ReceiveSnapshots();
+    void SendAck(std::uint32_t sequence);
+    void UpdateStats(float deltaTime) noexcept;
+    void Draw() const;
+    void DrawEntity(const SpectatorProtocol::Entity& entity, Vector2 position, float radius) const;
+    void DrawStatus() const;
+};
+
+} // namespace PlayAsGobo
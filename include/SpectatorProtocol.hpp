@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Wire format shared by the spectator server (inside the game) and the
+// spectator client. Every datagram is one snapshot, encoded as a delta
+// against a snapshot the client has acknowledged, or as a keyframe.
+namespace SpectatorProtocol {
+
+inline constexpr std::uint16_t DEFAULT_PORT = 47800;
+inline constexpr std::uint32_t MAGIC = 0x53424F47u; // "GOBS"
+inline constexpr std::uint8_t VERSION = 1;
+inline constexpr std::uint32_t NO_BASE = 0xFFFFFFFFu;
+inline constexpr std::size_t MAX_DATAGRAM_SIZE = 60000;
+
+// Positions are sent in half pixels, radii in quarter pixels
+inline constexpr float POSITION_SCALE = 2.0f;
+inline constexpr float RADIUS_SCALE = 4.0f;
+
+enum class PacketType : std::uint8_t {
+    Snapshot,
+    Ack // Client -> server; also serves as the hello of a new client
+};
+
+enum class EntityKind : std::uint8_t {
+    Player,
+    Enemy,
+    Emitter // An explosion's particle emitter
+};
+
+// One quantised entity. key = kind << 16 | id, and snapshots are sorted by key.
+struct Entity {
+    std::uint32_t key{0};
+    std::int32_t x{0};
+    std::int32_t y{0};
+    std::uint16_t radius{0};
+    std::uint8_t frame{0};    // Animation frame, or 0..255 progress for emitters
+    std::uint8_t flags{0};    // FLAG_* bits plus the archetype in the upper nibble
+
+    static constexpr std::uint8_t FLAG_FACING_LEFT = 1u << 0;
+    static constexpr std::uint8_t FLAG_BOMB_READY = 1u << 1;
+
+    [[nodiscard]] EntityKind GetKind() const noexcept { return static_cast<EntityKind>(key >> 16); }
+    [[nodiscard]] bool operator==(const Entity& other) const noexcept {
+        return key == other.key && x == other.x && y == other.y && radius == other.radius &&
+               frame == other.frame && flags == other.flags;
+    }
+};
+
+// World rectangles in whole pixels
+struct WorldLayout {
+    std::int32_t groundX{0};
+    std::int32_t groundY{0};
+    std::int32_t groundWidth{0};
+    std::int32_t groundHeight{0};
+    std::int32_t finishLineX{0};
+    std::int32_t finishLineY{0};
+    std::int32_t finishLineWidth{0};
+    std::int32_t finishLineHeight{0};
+
+    [[nodiscard]] bool operator==(const WorldLayout& other) const noexcept;
+};
+
+struct Snapshot {
+    std::uint32_t sequence{0};
+    WorldLayout layout;
+    std::int32_t killCount{0};
+    std::vector<Entity> entities; // Sorted by key
+};
+
+[[nodiscard]] constexpr std::uint32_t MakeKey(EntityKind kind, std::uint16_t id) noexcept {
+    return (static_cast<std::uint32_t>(kind) << 16) | id;
+}
+
+// Appends the encoding of current (against base, or a keyframe when base is null)
+void EncodeSnapshot(const Snapshot& current, const Snapshot* base, std::vector<std::uint8_t>& output);
+
+// Reads the base sequence a datagram was encoded against; false if it is not a snapshot
+[[nodiscard]] bool PeekBaseSequence(const std::uint8_t* data, std::size_t size, std::uint32_t& baseSequence) noexcept;
+
+// Decodes a datagram; base must be the snapshot PeekBaseSequence named (null for keyframes)
+[[nodiscard]] bool DecodeSnapshot(const std::uint8_t* data, std::size_t size, const Snapshot* base, Snapshot& output);
+
+// Ack datagrams are fixed size
+void EncodeAck(std::uint32_t sequence, std::vector<std::uint8_t>& output);
+[[nodiscard]] bool DecodeAck(const std::uint8_t* data, std::size_t size, std::uint32_t& sequence) noexcept;
+
+} // namespace SpectatorProtocol
+
+} // namespace PlayAsGobo
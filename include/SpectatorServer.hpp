@@ -0,0 +1,77 @@
+#pragma once
+
+#include "SpectatorProtocol.hpp"
+#include "UdpSocket.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Streams the world to spectator clients on the same machine. Each client
+// gets every snapshot encoded against the newest snapshot it acknowledged,
+// so a lost datagram only costs a larger delta, never a resync round trip.
+class SpectatorServer {
+public:
+    // Constructor
+    SpectatorServer() = default;
+
+    // Disable copy and move operations (owns a socket and the snapshot history)
+    SpectatorServer(const SpectatorServer&) = delete;
+    SpectatorServer& operator=(const SpectatorServer&) = delete;
+    SpectatorServer(SpectatorServer&&) = delete;
+    SpectatorServer& operator=(SpectatorServer&&) = delete;
+
+    // Destructor
+    ~SpectatorServer() = default;
+
+    [[nodiscard]] bool Open(std::uint16_t port);
+    void Close() noexcept;
+
+    // Per-tick flow: Poll() for acks, and when IsSnapshotDue() fill the slot
+    // returned by BeginSnapshot() and hand it back with SendSnapshot()
+    void Poll();
+    [[nodiscard]] bool IsSnapshotDue() noexcept;
+    [[nodiscard]] SpectatorProtocol::Snapshot& BeginSnapshot() noexcept;
+    void SendSnapshot();
+
+    // Getters
+    [[nodiscard]] bool IsOpen() const noexcept { return m_socket.IsOpen(); }
+    [[nodiscard]] std::size_t GetClientCount() const noexcept { return m_clientCount; }
+    [[nodiscard]] double GetLastEncodeMicroseconds() const noexcept { return m_lastEncodeMicroseconds; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Constants
+    static constexpr std::size_t HISTORY_SIZE = 64;    // ~3 seconds of snapshots to delta against
+    static constexpr std::size_t MAX_CLIENTS = 4;
+    static constexpr std::uint32_t SEND_INTERVAL_TICKS = 3; // 20 Hz at 60 ticks per second
+    static constexpr std::chrono::seconds CLIENT_TIMEOUT{5};
+
+    struct Client {
+        UdpEndpoint endpoint;
+        std::uint32_t ackedSequence{SpectatorProtocol::NO_BASE};
+        Clock::time_point lastHeard;
+    };
+
+    // Member variables
+    UdpSocket m_socket;
+    std::array<SpectatorProtocol::Snapshot, HISTORY_SIZE> m_history;
+    std::array<Client, MAX_CLIENTS> m_clients;
+    std::size_t m_clientCount{0};
+    std::uint32_t m_nextSequence{0};
+    std::uint32_t m_tickCounter{0};
+    std::vector<std::uint8_t> m_sendBuffer;
+    std::array<std::uint8_t, 64> m_receiveBuffer{};
+    double m_lastEncodeMicroseconds{0.0};
+
+    // Private helper methods
+    [[nodiscard]] const SpectatorProtocol::Snapshot* FindSnapshot(std::uint32_t sequence) const noexcept;
+    void HandleAck(const UdpEndpoint& sender, std::uint32_t sequence);
+    void DropSilentClients();
+};
+
+} // namespace PlayAsGobo
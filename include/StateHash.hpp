@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Groups of simulation state hashed separately, so a divergence can be traced
+// to the part of the game that caused it
+enum class StateHashField : std::uint8_t {
+    Player,
+    Enemies,
+    Explosions,
+    Projectiles,
+    Terrain,
+    Timers,
+    Random,
+    Count
+};
+
+inline constexpr std::size_t STATE_HASH_FIELD_COUNT = static_cast<std::size_t>(StateHashField::Count);
+
+[[nodiscard]] const char* GetStateHashFieldName(StateHashField field) noexcept;
+
+// Streaming 64-bit hash over the exact bit patterns of the values fed to it.
+// Floats are hashed bitwise on purpose: the point is to catch results that
+// differ in the last ulp between builds, not to compare them approximately.
+class StateHasher {
+public:
+    template<typename T>
+    void Add(const T& value) noexcept {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(std::uint64_t),
+                      "StateHasher only takes small trivially copyable values");
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        Mix(bits);
+    }
+
+    void Mix(std::uint64_t bits) noexcept {
+        m_state ^= bits * PRIME_A;
+        m_state = ((m_state << 31) | (m_state >> 33)) * PRIME_B;
+    }
+
+    [[nodiscard]] std::uint64_t Get() const noexcept {
+        // Final avalanche so fields that differ in one bit differ everywhere
+        std::uint64_t hash = m_state;
+        hash ^= hash >> 33;
+        hash *= PRIME_C;
+        hash ^= hash >> 29;
+        return hash;
+    }
+
+private:
+    // Constants
+    static constexpr std::uint64_t PRIME_A = 0x9E3779B185EBCA87ull;
+    static constexpr std::uint64_t PRIME_B = 0xC2B2AE3D27D4EB4Full;
+    static constexpr std::uint64_t PRIME_C = 0x165667B19E3779F9ull;
+    static constexpr std::uint64_t SEED = 0x27D4EB2F165667C5ull;
+
+    // Member variables
+    std::uint64_t m_state{SEED};
+};
+
+// Hash of one simulated tick, counted from the start of the session
+struct StateHashRecord {
+    std::uint32_t tick{0};
+    std::uint32_t reserved{0};
+    std::uint64_t combined{0};
+    std::array<std::uint64_t, STATE_HASH_FIELD_COUNT> fields{};
+};
+
+static_assert(std::is_trivially_copyable_v<StateHashRecord>, "StateHashRecord is written with raw I/O");
+
+// Append-only file of per-tick hashes, plus the offline comparison of two such files
+class StateHashLog {
+public:
+    // Constructor
+    StateHashLog() = default;
+
+    // Disable copy and move operations (owns an open file)
+    StateHashLog(const StateHashLog&) = delete;
+    StateHashLog& operator=(const StateHashLog&) = delete;
+    StateHashLog(StateHashLog&&) = delete;
+    StateHashLog& operator=(StateHashLog&&) = delete;
+
+    // Destructor
+    ~StateHashLog() = default;
+
+    // Writing
+    [[nodiscard]] bool Open(const std::string& path);
+    void Append(const StateHashRecord& record);
+    void Close() noexcept;
+    [[nodiscard]] bool IsOpen() const noexcept { return m_file.is_open(); }
+
+    // Reading and comparison
+    [[nodiscard]] static bool Load(const std::string& path, std::vector<StateHashRecord>& records);
+
+    // Prints the first tick whose hash differs and the fields that differ there.
+    // Returns 0 when the logs match, 1 when they diverge and 2 when a log can't be read.
+    [[nodiscard]] static int Compare(const std::string& firstPath, const std::string& secondPath,
+                                     std::ostream& output);
+
+private:
+    // Constants
+    static constexpr std::array<char, 8> MAGIC = {'G', 'O', 'B', 'O', 'H', 'S', 'H', '\0'};
+    static constexpr std::uint32_t FILE_VERSION = 1;
+
+    // File header, followed by records in tick order
+    struct Header {
+        std::array<char, 8> magic{};
+        std::uint32_t version{0};
+        std::uint32_t fieldCount{0};
+    };
+
+    // Member variables
+    std::ofstream m_file;
+};
+
+} // namespace PlayAsGobo
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// One textured quad of level geometry, in world space
+struct StaticTile {
+    Rectangle destination;
+    Rectangle source; // Texel rectangle within the texture
+    Color tint;
+};
+
+// Level tiles that share a texture, baked into per-chunk vertex buffers once
+// and drawn with one call per visible chunk. Per-frame CPU cost depends on
+// the number of chunks, not the number of tiles.
+class StaticTileMesh {
+public:
+    // Constructor
+    StaticTileMesh() = default;
+
+    // Disable copy and move operations (owns GPU buffers)
+    StaticTileMesh(const StaticTileMesh&) = delete;
+    StaticTileMesh& operator=(const StaticTileMesh&) = delete;
+    StaticTileMesh(StaticTileMesh&&) = delete;
+    StaticTileMesh& operator=(StaticTileMesh&&) = delete;
+
+    // Destructor
+    ~StaticTileMesh();
+
+    // Replaces the whole mesh; returns false when vertex arrays are unavailable
+    // (OpenGL 1.1), in which case callers keep drawing the tiles immediately
+    [[nodiscard]] bool Build(const Texture2D& texture, const std::vector<StaticTile>& tiles);
+    void Unload() noexcept;
+
+    // Draws the chunks overlapping visibleArea (world space) inside BeginMode2D
+    void Draw(const Rectangle& visibleArea) const;
+
+    // Getters
+    [[nodiscard]] bool IsReady() const noexcept { return !m_chunks.empty(); }
+    [[nodiscard]] std::size_t GetChunkCount() const noexcept { return m_chunks.size(); }
+    [[nodiscard]] std::size_t GetTileCount() const noexcept { return m_tileCount; }
+
+private:
+    // Constants
+    static constexpr float CHUNK_SIZE = 512.0f;
+    static constexpr std::size_t MAX_QUADS_PER_CHUNK = 65536 / 4; // 16-bit indices
+
+    struct Vertex {
+        float x, y, z;
+        float u, v;
+        std::uint8_t r, g, b, a;
+    };
+
+    struct Chunk {
+        Rectangle bounds;
+        unsigned int vertexArray{0};
+        unsigned int vertexBuffer{0};
+        unsigned int indexBuffer{0};
+        int indexCount{0};
+    };
+
+    // Member variables
+    Texture2D m_texture{};
+    std::vector<Chunk> m_chunks;
+    std::size_t m_tileCount{0};
+
+    // Private helper methods
+    [[nodiscard]] bool UploadChunk(const std::vector<const StaticTile*>& tiles, Chunk& chunk) const;
+};
+
+} // namespace PlayAsGobo
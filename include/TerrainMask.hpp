@@ -0,0 +1,82 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Per-pixel solidity bitmask and matching texture for a destructible ground
+// rectangle. Explosions carve circles out of it; only the rows and columns that
+// changed since the last frame are re-uploaded to the GPU. Collision queries
+// walk a single row or column, so their cost grows with the query radius only.
+class TerrainMask {
+public:
+    // Constructor
+    TerrainMask() = default;
+
+    // Disable copy and move operations (owns a GPU texture)
+    TerrainMask(const TerrainMask&) = delete;
+    TerrainMask& operator=(const TerrainMask&) = delete;
+    TerrainMask(TerrainMask&&) = delete;
+    TerrainMask& operator=(TerrainMask&&) = delete;
+
+    // Destructor
+    ~TerrainMask();
+
+    // Setup (requires a current GL context); fills the area by tiling tileImage
+    void Rebuild(const Rectangle& bounds, const Image& tileImage);
+    void Unload() noexcept;
+
+    // Destruction
+    void Carve(Vector2 center, float radius);
+    void UploadDirtyRegion();
+
+    // Rendering
+    void Draw(Color tint) const;
+
+    // Collision queries in world coordinates; each returns the world coordinate
+    // of the first solid edge met while walking from -> to, if any
+    [[nodiscard]] bool IsSolid(float x, float y) const noexcept;
+    [[nodiscard]] std::optional<float> FindSurfaceBelow(float x, float fromY, float toY) const noexcept;
+    [[nodiscard]] std::optional<float> FindCeilingAbove(float x, float fromY, float toY) const noexcept;
+    [[nodiscard]] std::optional<float> FindWall(float y, float fromX, float toX) const noexcept;
+
+    // State queries
+    [[nodiscard]] bool IsReady() const noexcept { return m_texture.id != 0; }
+    [[nodiscard]] const Rectangle& GetBounds() const noexcept { return m_bounds; }
+    [[nodiscard]] bool HasPendingUpload() const noexcept { return m_dirtyMaxX >= m_dirtyMinX; }
+
+private:
+    // Constants
+    static constexpr std::int32_t BITS_PER_WORD = 64;
+    static constexpr std::int32_t MAX_TEXTURE_DIMENSION = 8192;
+    static constexpr std::int32_t BEDROCK_ROWS = 8;
+
+    // Member variables
+    Rectangle m_bounds{0.0f, 0.0f, 0.0f, 0.0f};
+    std::int32_t m_width{0};
+    std::int32_t m_height{0};
+    std::int32_t m_wordsPerRow{0};
+    std::vector<std::uint64_t> m_solidBits;
+    std::vector<Color> m_pixels;
+    std::vector<Color> m_uploadBuffer;
+    Texture2D m_texture{};
+
+    // Dirty rectangle in cell coordinates (inclusive, empty when max < min)
+    std::int32_t m_dirtyMinX{0};
+    std::int32_t m_dirtyMinY{0};
+    std::int32_t m_dirtyMaxX{-1};
+    std::int32_t m_dirtyMaxY{-1};
+
+    // Private helper methods
+    [[nodiscard]] bool IsCellSolid(std::int32_t column, std::int32_t row) const noexcept;
+    void ClearRun(std::int32_t row, std::int32_t firstColumn, std::int32_t lastColumn) noexcept;
+    void MarkDirty(std::int32_t minX, std::int32_t minY, std::int32_t maxX, std::int32_t maxY) noexcept;
+    void ResetDirty() noexcept;
+    [[nodiscard]] std::int32_t ToColumn(float x) const noexcept;
+    [[nodiscard]] std::int32_t ToRow(float y) const noexcept;
+};
+
+} // namespace PlayAsGobo
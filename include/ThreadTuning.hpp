@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace PlayAsGobo {
+
+// Threads the game owns or hosts, each tuned as a group
+enum class ThreadRole : std::uint8_t {
+    Game,   // Main thread: input, simulation and rendering
+    Audio,  // The audio device's callback thread
+    Worker, // Background helpers such as the capture encoder
+    Count
+};
+
+inline constexpr std::size_t THREAD_ROLE_COUNT = static_cast<std::size_t>(ThreadRole::Count);
+
+enum class ThreadPriority : std::uint8_t {
+    Default,            // Left to the OS scheduler
+    High,               // Raised within the normal scheduling class
+    RealtimeFifo,       // SCHED_FIFO where permitted
+    RealtimeRoundRobin  // SCHED_RR where permitted
+};
+
+struct ThreadRoleSettings {
+    std::vector<int> cpus;  // Empty leaves affinity to the OS
+    ThreadPriority priority{ThreadPriority::Default};
+    int realtimePriority{50}; // 1-99, only used by the realtime policies
+};
+
+// Thread placement for a machine, loaded from a small key = value file:
+//
+//   game.cpus = 2
+//   audio.cpus = 3
+//   audio.priority = fifo        # default | high | fifo | rr
+//   audio.realtime_priority = 70
+//   worker.cpus = 0-1
+//   worker.count = 2             # 0 picks from the core count
+struct ThreadSettings {
+    std::array<ThreadRoleSettings, THREAD_ROLE_COUNT> roles;
+    std::size_t workerCount{0};
+
+    // Returns false only when the file can't be read; bad lines are warned about and skipped
+    [[nodiscard]] static bool LoadFromFile(const std::string& path, ThreadSettings& settings);
+    [[nodiscard]] std::size_t ResolveWorkerCount() const noexcept;
+};
+
+// Process-wide application of ThreadSettings. Configure() once before any
+// thread starts, then each thread calls ApplyToCurrentThread() with its role.
+namespace ThreadTuning {
+
+inline constexpr const char* DEFAULT_CONFIG_PATH = "threads.cfg";
+
+void Configure(const ThreadSettings& settings);
+[[nodiscard]] const ThreadSettings& GetSettings() noexcept;
+[[nodiscard]] std::size_t GetWorkerCount() noexcept;
+
+// Safe to call from the audio callback: no allocation, no locks, no logging
+void ApplyToCurrentThread(ThreadRole role) noexcept;
+
+// The audio thread applies its settings asynchronously; wait for it before reporting
+[[nodiscard]] bool WaitUntilApplied(ThreadRole role, std::chrono::milliseconds timeout) noexcept;
+[[nodiscard]] bool IsRequested(ThreadRole role) noexcept;
+
+void WriteReport(std::ostream& output);
+
+} // namespace ThreadTuning
+
+} // namespace PlayAsGobo
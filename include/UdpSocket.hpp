@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PlayAsGobo {
+
+// IPv4 address and port in host byte order
+struct UdpEndpoint {
+    std::uint32_t address{0};
+    std::uint16_t port{0};
+
+    [[nodiscard]] bool operator==(const UdpEndpoint& other) const noexcept {
+        return address == other.address && port == other.port;
+    }
+};
+
+// Minimal non-blocking UDP socket bound to the loopback interface. Only the
+// spectator stream uses it, so it never talks to anything off the machine.
+class UdpSocket {
+public:
+    // Constructor
+    UdpSocket() = default;
+
+    // Disable copy and move operations (owns an OS socket handle)
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+    UdpSocket(UdpSocket&&) = delete;
+    UdpSocket& operator=(UdpSocket&&) = delete;
+
+    // Destructor
+    ~UdpSocket();
+
+    // Binds to 127.0.0.1:port; port 0 picks an ephemeral port
+    [[nodiscard]] bool Open(std::uint16_t port);
+    void Close() noexcept;
+
+    // Returns false if the datagram could not be queued (it is dropped, as UDP would)
+    bool SendTo(const UdpEndpoint& endpoint, const void* data, std::size_t size) noexcept;
+
+    // Returns the datagram size, or 0 when nothing is waiting
+    [[nodiscard]] std::size_t Receive(void* buffer, std::size_t capacity, UdpEndpoint& sender) noexcept;
+
+    // Getters
+    [[nodiscard]] bool IsOpen() const noexcept { return m_handle != INVALID_HANDLE; }
+
+    [[nodiscard]] static UdpEndpoint Loopback(std::uint16_t port) noexcept;
+
+private:
+    // Constants
+    static constexpr std::intptr_t INVALID_HANDLE = -1;
+
+    // Member variables
+    std::intptr_t m_handle{INVALID_HANDLE};
+};
+
+} // namespace PlayAsGobo
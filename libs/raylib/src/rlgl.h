@@ -422,6 +422,16 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Vertices reserved in the active render batch, written directly by the caller
+// NOTE: Not part of upstream rlgl, see rlReserveVertices()
+typedef struct rlVertexSpan {
+    int count;                  // Number of vertices granted (0 if bulk submission is unavailable)
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex), Z is set on commit
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex)
+} rlVertexSpan;
+#define RLGL_HAS_RESERVE_VERTICES   // Lets users detect this fork's bulk submission API
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -725,6 +735,8 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch dat
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI rlVertexSpan rlReserveVertices(int count);        // Reserve up to count vertices in the active batch for direct writing
+RLAPI void rlCommitVertices(int count);                 // Add the first count reserved vertices to the current draw
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -3171,6 +3183,60 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Reserve room for up to count vertices in the active render batch
+// NOTE: Bulk alternative to one rlVertex/rlTexCoord/rlColor call per attribute, with a single
+// limit check. Use between rlBegin()/rlEnd(): write XY, UV and RGBA through the span, then call
+// rlCommitVertices() with the number written before any other vertex call. Grants what fits in
+// the current buffer, only flushing when not even one quad fits, so callers loop for more.
+// Grants nothing on OpenGL 1.1 or while a rlPushMatrix() transform is active (positions are
+// not transformed), in which case callers fall back to per-vertex calls
+rlVertexSpan rlReserveVertices(int count)
+{
+    rlVertexSpan span = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((count <= 0) || RLGL.State.transformRequired) return span;
+
+    rlCheckRenderBatchLimit(4);
+
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    int available = buffer->elementCount*4 - RLGL.State.vertexCounter - 1;
+    available -= available%4;       // Whole quads only, so a later flush never splits one
+
+    span.count = (count < available)? count : available;
+    span.vertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+    span.texcoords = buffer->texcoords + 2*RLGL.State.vertexCounter;
+    span.colors = buffer->colors + 4*RLGL.State.vertexCounter;
+#endif
+
+    return span;
+}
+
+// Add the first count vertices of the last reservation to the current draw
+// NOTE: Sets their depth and normal like rlVertex3f() does; count must not exceed the span
+void rlCommitVertices(int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (count <= 0) return;
+
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    float *vertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+    float *normals = buffer->normals + 3*RLGL.State.vertexCounter;
+    const float depth = RLGL.currentBatch->currentDepth;
+
+    for (int i = 0; i < count; i++)
+    {
+        vertices[3*i + 2] = depth;
+        normals[3*i] = RLGL.State.normalx;
+        normals[3*i + 1] = RLGL.State.normaly;
+        normals[3*i + 2] = RLGL.State.normalz;
+    }
+
+    RLGL.State.vertexCounter += count;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count;
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
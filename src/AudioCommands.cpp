@@ -0,0 +1,332 @@
+#include "AudioCommands.hpp"
+#include "ThreadTuning.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace PlayAsGobo {
+
+namespace {
+
+// Constants
+constexpr std::size_t RING_CAPACITY = 256;       // Far more than a frame ever queues
+constexpr std::size_t MAX_TRACKED_STREAMS = 32;  // Distinct sounds and music with published status
+constexpr std::chrono::milliseconds POLL_INTERVAL{2};
+constexpr std::chrono::milliseconds IDLE_POLL_INTERVAL{250}; // Nothing playing; a new command wakes it sooner
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+enum class CommandType : std::uint8_t {
+    PlaySound,
+    StopSound,
+    SetSoundVolume,
+    SetSoundPan,
+    PlayMusic,
+    StopMusic,
+    PauseMusic,
+    ResumeMusic,
+    SetMusicVolume
+};
+
+struct Command {
+    CommandType type{CommandType::PlaySound};
+    float value{0.0f};
+    Sound sound{};
+    Music music{};
+};
+
+// One published status slot; the key is written last, so a reader that
+// finds its stream also sees a valid flag
+struct StreamStatus {
+    std::atomic<const void*> key{nullptr};
+    std::atomic<bool> isPlaying{false};
+};
+
+// Audio-thread-only view of a tracked stream
+struct TrackedStream {
+    AudioStream stream{};
+    Music music{};
+    bool isMusic{false};
+    bool isStreaming{false}; // Music between PlayMusic and StopMusic
+};
+
+struct AudioCommandState {
+    std::array<Command, RING_CAPACITY> ring{};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head{0};      // Written by the game thread
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail{0};      // Written by the audio thread
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> processed{0}; // Commands whose status is published
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<bool> isRunning{false};
+    std::atomic<bool> isIdle{false};
+    std::mutex idleMutex;
+    std::condition_variable idleWake;
+    std::array<StreamStatus, MAX_TRACKED_STREAMS> status{};
+    std::array<TrackedStream, MAX_TRACKED_STREAMS> tracked{}; // Parallel to status, audio thread only
+    std::size_t trackedCount{0};
+    std::thread thread;
+};
+
+AudioCommandState s_state;
+
+[[nodiscard]] const void* GetKey(const AudioStream& stream) noexcept {
+    return stream.buffer;
+}
+
+// Audio thread only (or the game thread before Start/after Stop)
+TrackedStream* Track(const AudioStream& stream, const Music* music) noexcept {
+    const void* key = GetKey(stream);
+    for (std::size_t i = 0; i < s_state.trackedCount; ++i) {
+        if (GetKey(s_state.tracked[i].stream) == key) return &s_state.tracked[i];
+    }
+    if (s_state.trackedCount >= MAX_TRACKED_STREAMS) return nullptr;
+
+    TrackedStream& tracked = s_state.tracked[s_state.trackedCount];
+    tracked = TrackedStream{};
+    tracked.stream = stream;
+    tracked.isMusic = music != nullptr;
+    if (music) tracked.music = *music;
+
+    StreamStatus& status = s_state.status[s_state.trackedCount++];
+    status.isPlaying.store(false, std::memory_order_relaxed);
+    status.key.store(key, std::memory_order_release);
+    return &tracked;
+}
+
+void Execute(const Command& command) noexcept {
+    switch (command.type) {
+        case CommandType::PlaySound:
+            Track(command.sound.stream, nullptr);
+            ::PlaySound(command.sound);
+            break;
+        case CommandType::StopSound:
+            ::StopSound(command.sound);
+            break;
+        case CommandType::SetSoundVolume:
+            ::SetSoundVolume(command.sound, command.value);
+            break;
+        case CommandType::SetSoundPan:
+            ::SetSoundPan(command.sound, command.value);
+            break;
+        case CommandType::PlayMusic:
+            if (TrackedStream* tracked = Track(command.music.stream, &command.music)) {
+                tracked->music = command.music; // Picks up looping changes
+                tracked->isStreaming = true;
+            }
+            ::PlayMusicStream(command.music);
+            break;
+        case CommandType::StopMusic:
+            if (TrackedStream* tracked = Track(command.music.stream, &command.music)) {
+                tracked->isStreaming = false;
+            }
+            ::StopMusicStream(command.music);
+            break;
+        case CommandType::PauseMusic:
+            ::PauseMusicStream(command.music);
+            break;
+        case CommandType::ResumeMusic:
+            ::ResumeMusicStream(command.music);
+            break;
+        case CommandType::SetMusicVolume:
+            ::SetMusicVolume(command.music, command.value);
+            break;
+    }
+}
+
+// Refills music buffers and republishes every tracked stream's status;
+// returns whether anything is still playing
+bool UpdateStreams() noexcept {
+    bool isAnyPlaying = false;
+    for (std::size_t i = 0; i < s_state.trackedCount; ++i) {
+        const TrackedStream& tracked = s_state.tracked[i];
+        if (tracked.isStreaming) {
+            ::UpdateMusicStream(tracked.music);
+        }
+        const bool isPlaying = ::IsAudioStreamPlaying(tracked.stream);
+        s_state.status[i].isPlaying.store(isPlaying, std::memory_order_relaxed);
+        isAnyPlaying = isAnyPlaying || isPlaying;
+    }
+    return isAnyPlaying;
+}
+
+// With nothing playing there is nothing to stream, so the thread sleeps until
+// a command arrives instead of polling; a paused or backgrounded game costs nothing
+void WaitWhileIdle() {
+    s_state.isIdle.store(true);
+    {
+        std::unique_lock<std::mutex> lock(s_state.idleMutex);
+        s_state.idleWake.wait_for(lock, IDLE_POLL_INTERVAL, [] {
+            return s_state.head.load() != s_state.tail.load(std::memory_order_relaxed) ||
+                   !s_state.isRunning.load(std::memory_order_relaxed);
+        });
+    }
+    s_state.isIdle.store(false, std::memory_order_relaxed);
+}
+
+// Producer side; the lock only orders the notify after a waiter's predicate check
+void WakeIfIdle() noexcept {
+    if (s_state.isIdle.load()) {
+        { std::lock_guard<std::mutex> lock(s_state.idleMutex); }
+        s_state.idleWake.notify_one();
+    }
+}
+
+void RunAudioThread() {
+    ThreadTuning::ApplyToCurrentThread(ThreadRole::Worker);
+
+    bool keepRunning = true;
+    while (keepRunning) {
+        // Read before draining, so commands queued before Stop() still run
+        keepRunning = s_state.isRunning.load(std::memory_order_acquire);
+
+        const std::size_t head = s_state.head.load(std::memory_order_acquire);
+        std::size_t tail = s_state.tail.load(std::memory_order_relaxed);
+        for (; tail != head; ++tail) {
+            Execute(s_state.ring[tail % RING_CAPACITY]);
+            s_state.tail.store(tail + 1, std::memory_order_release); // Frees the slot
+        }
+
+        const bool isAnyPlaying = UpdateStreams();
+        s_state.processed.store(tail, std::memory_order_release);
+
+        if (!keepRunning) break;
+        if (isAnyPlaying) {
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        } else {
+            WaitWhileIdle();
+        }
+    }
+}
+
+void Push(const Command& command) noexcept {
+    if (!s_state.isRunning.load(std::memory_order_relaxed)) {
+        Execute(command);
+        return;
+    }
+
+    const std::size_t head = s_state.head.load(std::memory_order_relaxed);
+    if (head - s_state.tail.load(std::memory_order_acquire) >= RING_CAPACITY) {
+        s_state.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    s_state.ring[head % RING_CAPACITY] = command;
+    s_state.head.store(head + 1); // Sequentially consistent with isIdle, see WaitWhileIdle
+    WakeIfIdle();
+}
+
+void PushSound(CommandType type, const Sound& sound, float value = 0.0f) noexcept {
+    Command command;
+    command.type = type;
+    command.value = value;
+    command.sound = sound;
+    Push(command);
+}
+
+void PushMusic(CommandType type, const Music& music, float value = 0.0f) noexcept {
+    Command command;
+    command.type = type;
+    command.value = value;
+    command.music = music;
+    Push(command);
+}
+
+[[nodiscard]] bool IsStreamPlaying(const AudioStream& stream) noexcept {
+    if (!s_state.isRunning.load(std::memory_order_relaxed)) {
+        return ::IsAudioStreamPlaying(stream);
+    }
+    if (s_state.processed.load(std::memory_order_acquire) != s_state.head.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    const void* key = GetKey(stream);
+    for (const StreamStatus& status : s_state.status) {
+        const void* statusKey = status.key.load(std::memory_order_acquire);
+        if (statusKey == nullptr) break; // Slots fill in order
+        if (statusKey == key) return status.isPlaying.load(std::memory_order_relaxed);
+    }
+    return false;
+}
+
+} // namespace
+
+namespace AudioCommands {
+
+void Start() {
+    if (s_state.isRunning.load(std::memory_order_relaxed)) return;
+
+    s_state.isRunning.store(true, std::memory_order_release);
+    s_state.thread = std::thread(RunAudioThread);
+}
+
+void Stop() noexcept {
+    if (!s_state.isRunning.exchange(false)) return;
+    WakeIfIdle();
+
+    if (s_state.thread.joinable()) {
+        s_state.thread.join();
+    }
+
+    // Forget every stream; the caller is about to unload them
+    for (std::size_t i = 0; i < s_state.trackedCount; ++i) {
+        s_state.status[i].key.store(nullptr, std::memory_order_relaxed);
+    }
+    s_state.trackedCount = 0;
+}
+
+bool IsRunning() noexcept {
+    return s_state.isRunning.load(std::memory_order_relaxed);
+}
+
+void PlaySound(const Sound& sound) noexcept {
+    PushSound(CommandType::PlaySound, sound);
+}
+
+void StopSound(const Sound& sound) noexcept {
+    PushSound(CommandType::StopSound, sound);
+}
+
+void SetSoundVolume(const Sound& sound, float volume) noexcept {
+    PushSound(CommandType::SetSoundVolume, sound, volume);
+}
+
+void SetSoundPan(const Sound& sound, float pan) noexcept {
+    PushSound(CommandType::SetSoundPan, sound, pan);
+}
+
+void PlayMusic(const Music& music) noexcept {
+    PushMusic(CommandType::PlayMusic, music);
+}
+
+void StopMusic(const Music& music) noexcept {
+    PushMusic(CommandType::StopMusic, music);
+}
+
+void PauseMusic(const Music& music) noexcept {
+    PushMusic(CommandType::PauseMusic, music);
+}
+
+void ResumeMusic(const Music& music) noexcept {
+    PushMusic(CommandType::ResumeMusic, music);
+}
+
+void SetMusicVolume(const Music& music, float volume) noexcept {
+    PushMusic(CommandType::SetMusicVolume, music, volume);
+}
+
+bool IsSoundPlaying(const Sound& sound) noexcept {
+    return IsStreamPlaying(sound.stream);
+}
+
+bool IsMusicPlaying(const Music& music) noexcept {
+    return IsStreamPlaying(music.stream);
+}
+
+std::uint64_t GetDroppedCommandCount() noexcept {
+    return s_state.dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace AudioCommands
+
+} // namespace PlayAsGobo
@@ -0,0 +1,558 @@
+#include "BehaviourVM.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace PlayAsGobo {
+
+namespace {
+
+struct NamedRegister {
+    const char* name;
+    std::size_t reg;
+    bool writable;
+};
+
+constexpr std::size_t InputRegister(BehaviourInput input) noexcept {
+    return BehaviourProgram::FIRST_INPUT_REGISTER + static_cast<std::size_t>(input);
+}
+
+constexpr std::size_t UniformRegister(BehaviourUniform uniform) noexcept {
+    return BehaviourProgram::FIRST_UNIFORM_REGISTER + static_cast<std::size_t>(uniform);
+}
+
+constexpr std::size_t OutputRegister(BehaviourOutput output) noexcept {
+    return BehaviourProgram::FIRST_OUTPUT_REGISTER + static_cast<std::size_t>(output);
+}
+
+constexpr NamedRegister BUILTIN_NAMES[] = {
+    {"x", InputRegister(BehaviourInput::X), false},
+    {"y", InputRegister(BehaviourInput::Y), false},
+    {"radius", InputRegister(BehaviourInput::Radius), false},
+    {"on_ground", InputRegister(BehaviourInput::OnGround), false},
+    {"facing", InputRegister(BehaviourInput::Facing), false},
+    {"dt", UniformRegister(BehaviourUniform::DeltaTime), false},
+    {"player_x", UniformRegister(BehaviourUniform::PlayerX), false},
+    {"player_y", UniformRegister(BehaviourUniform::PlayerY), false},
+    {"finish_x", UniformRegister(BehaviourUniform::FinishX), false},
+    {"map_width", UniformRegister(BehaviourUniform::MapWidth), false},
+    {"ground_y", UniformRegister(BehaviourUniform::GroundY), false},
+    {"m0", BehaviourProgram::FIRST_MEMORY_REGISTER + 0, true},
+    {"m1", BehaviourProgram::FIRST_MEMORY_REGISTER + 1, true},
+    {"m2", BehaviourProgram::FIRST_MEMORY_REGISTER + 2, true},
+    {"m3", BehaviourProgram::FIRST_MEMORY_REGISTER + 3, true},
+    {"move", OutputRegister(BehaviourOutput::Move), true},
+    {"jump", OutputRegister(BehaviourOutput::Jump), true},
+    {"throw", OutputRegister(BehaviourOutput::Throw), true},
+    {"fly", OutputRegister(BehaviourOutput::Fly), true},
+    {"velocity_y", OutputRegister(BehaviourOutput::VelocityY), true},
+};
+
+static_assert(BehaviourProgram::FIRST_MEMORY_REGISTER + 3 < BehaviourProgram::FIRST_OUTPUT_REGISTER,
+              "BUILTIN_NAMES lists every memory slot");
+
+// Single-pass compiler: each line is tokenised, parsed by recursive descent and
+// emitted straight to three-address code. Every subexpression gets a fresh
+// register; scripts are short, so registers are not reused.
+class ScriptCompiler {
+public:
+    ScriptCompiler(std::vector<BehaviourInstruction>& code,
+                   std::vector<std::pair<std::uint8_t, float>>& constants)
+        : m_code(code), m_constants(constants) {
+        m_isTemporary.fill(false);
+    }
+
+    void CompileLine(const std::string& line) {
+        Tokenise(line);
+        if (m_tokens.empty()) return;
+
+        if (m_tokens.size() < 3 || m_tokens[0].kind != TokenKind::Name || !IsSymbol(m_tokens[1], "=")) {
+            throw std::invalid_argument("expected 'name = expression'");
+        }
+        const std::string target = m_tokens[0].text;
+        m_position = 2;
+
+        const std::size_t value = ParseExpression();
+        if (m_position != m_tokens.size()) {
+            throw std::invalid_argument("unexpected '" + m_tokens[m_position].text + "'");
+        }
+        Assign(target, value);
+    }
+
+    [[nodiscard]] std::size_t GetRegisterCount() const noexcept { return m_nextRegister; }
+
+private:
+    enum class TokenKind : std::uint8_t { Name, Number, Symbol };
+
+    struct Token {
+        TokenKind kind;
+        std::string text;
+        float number{0.0f};
+    };
+
+    std::vector<BehaviourInstruction>& m_code;
+    std::vector<std::pair<std::uint8_t, float>>& m_constants;
+    std::map<std::string, std::size_t> m_locals;
+    std::array<bool, BehaviourProgram::MAX_REGISTERS> m_isTemporary{};
+    std::size_t m_nextRegister{BehaviourProgram::FIRST_FREE_REGISTER};
+    std::vector<Token> m_tokens;
+    std::size_t m_position{0};
+
+    static bool IsSymbol(const Token& token, const char* symbol) {
+        return token.kind == TokenKind::Symbol && token.text == symbol;
+    }
+
+    bool Accept(const char* symbol) {
+        if (m_position < m_tokens.size() && IsSymbol(m_tokens[m_position], symbol)) {
+            ++m_position;
+            return true;
+        }
+        return false;
+    }
+
+    bool AcceptKeyword(const char* keyword) {
+        if (m_position < m_tokens.size() && m_tokens[m_position].kind == TokenKind::Name &&
+            m_tokens[m_position].text == keyword) {
+            ++m_position;
+            return true;
+        }
+        return false;
+    }
+
+    void Expect(const char* symbol) {
+        if (!Accept(symbol)) {
+            throw std::invalid_argument(std::string("expected '") + symbol + "'");
+        }
+    }
+
+    void Tokenise(const std::string& line) {
+        m_tokens.clear();
+        m_position = 0;
+
+        std::size_t i = 0;
+        while (i < line.size()) {
+            const char c = line[i];
+            if (c == '#') break;
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                ++i;
+                continue;
+            }
+
+            if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+                std::size_t end = i;
+                while (end < line.size() && (std::isalnum(static_cast<unsigned char>(line[end])) || line[end] == '_')) ++end;
+                m_tokens.push_back({TokenKind::Name, line.substr(i, end - i)});
+                i = end;
+            } else if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+                std::size_t end = i;
+                while (end < line.size() && (std::isdigit(static_cast<unsigned char>(line[end])) || line[end] == '.')) ++end;
+                const std::string text = line.substr(i, end - i);
+                std::size_t parsed = 0;
+                float value = 0.0f;
+                try {
+                    value = std::stof(text, &parsed);
+                } catch (const std::exception&) {
+                    parsed = 0;
+                }
+                if (parsed != text.size()) {
+                    throw std::invalid_argument("bad number '" + text + "'");
+                }
+                m_tokens.push_back({TokenKind::Number, text, value});
+                i = end;
+            } else {
+                const std::string pair = line.substr(i, 2);
+                if (pair == "<=" || pair == ">=" || pair == "==" || pair == "!=") {
+                    m_tokens.push_back({TokenKind::Symbol, pair});
+                    i += 2;
+                } else if (std::string("+-*/()<>=,").find(c) != std::string::npos) {
+                    m_tokens.push_back({TokenKind::Symbol, std::string(1, c)});
+                    ++i;
+                } else {
+                    throw std::invalid_argument(std::string("unexpected character '") + c + "'");
+                }
+            }
+        }
+    }
+
+    std::size_t AllocateRegister() {
+        if (m_nextRegister >= BehaviourProgram::MAX_REGISTERS) {
+            throw std::invalid_argument("script needs more than " +
+                                        std::to_string(BehaviourProgram::MAX_REGISTERS) + " registers");
+        }
+        return m_nextRegister++;
+    }
+
+    std::size_t Emit(BehaviourOpcode opcode, std::size_t a, std::size_t b = 0, std::size_t c = 0) {
+        const std::size_t destination = AllocateRegister();
+        m_isTemporary[destination] = true;
+        m_code.push_back({opcode, static_cast<std::uint8_t>(destination), static_cast<std::uint8_t>(a),
+                          static_cast<std::uint8_t>(b), static_cast<std::uint8_t>(c)});
+        return destination;
+    }
+
+    std::size_t Constant(float value) {
+        for (const auto& [reg, constant] : m_constants) {
+            if (constant == value) return reg;
+        }
+        const std::size_t reg = AllocateRegister();
+        m_constants.emplace_back(static_cast<std::uint8_t>(reg), value);
+        return reg;
+    }
+
+    std::size_t Lookup(const std::string& name) const {
+        for (const NamedRegister& builtin : BUILTIN_NAMES) {
+            if (name == builtin.name) return builtin.reg;
+        }
+        if (const auto it = m_locals.find(name); it != m_locals.end()) {
+            return it->second;
+        }
+        throw std::invalid_argument("unknown name '" + name + "'");
+    }
+
+    void Assign(const std::string& target, std::size_t value) {
+        std::size_t destination = 0;
+        bool found = false;
+        for (const NamedRegister& builtin : BUILTIN_NAMES) {
+            if (target == builtin.name) {
+                if (!builtin.writable) {
+                    throw std::invalid_argument("'" + target + "' is read-only");
+                }
+                destination = builtin.reg;
+                found = true;
+            }
+        }
+        if (!found) {
+            if (target == "and" || target == "or" || target == "not") {
+                throw std::invalid_argument("'" + target + "' is a keyword");
+            }
+            if (const auto it = m_locals.find(target); it != m_locals.end()) {
+                destination = it->second;
+            } else {
+                destination = AllocateRegister();
+                m_locals.emplace(target, destination);
+            }
+        }
+
+        // Retarget the instruction that produced a fresh temporary instead of copying it
+        if (m_isTemporary[value] && !m_code.empty() && m_code.back().destination == value) {
+            m_code.back().destination = static_cast<std::uint8_t>(destination);
+        } else if (value != destination) {
+            m_code.push_back({BehaviourOpcode::Copy, static_cast<std::uint8_t>(destination),
+                              static_cast<std::uint8_t>(value), 0, 0});
+        }
+    }
+
+    std::size_t ParseExpression() { return ParseOr(); }
+
+    std::size_t ParseOr() {
+        std::size_t left = ParseAnd();
+        while (AcceptKeyword("or")) {
+            left = Emit(BehaviourOpcode::Or, left, ParseAnd());
+        }
+        return left;
+    }
+
+    std::size_t ParseAnd() {
+        std::size_t left = ParseComparison();
+        while (AcceptKeyword("and")) {
+            left = Emit(BehaviourOpcode::And, left, ParseComparison());
+        }
+        return left;
+    }
+
+    std::size_t ParseComparison() {
+        const std::size_t left = ParseAdditive();
+        static constexpr std::pair<const char*, BehaviourOpcode> COMPARISONS[] = {
+            {"<", BehaviourOpcode::Less}, {"<=", BehaviourOpcode::LessEqual},
+            {">", BehaviourOpcode::Greater}, {">=", BehaviourOpcode::GreaterEqual},
+            {"==", BehaviourOpcode::Equal}, {"!=", BehaviourOpcode::NotEqual},
+        };
+        for (const auto& [symbol, opcode] : COMPARISONS) {
+            if (Accept(symbol)) {
+                return Emit(opcode, left, ParseAdditive());
+            }
+        }
+        return left;
+    }
+
+    std::size_t ParseAdditive() {
+        std::size_t left = ParseMultiplicative();
+        for (;;) {
+            if (Accept("+")) {
+                left = Emit(BehaviourOpcode::Add, left, ParseMultiplicative());
+            } else if (Accept("-")) {
+                left = Emit(BehaviourOpcode::Subtract, left, ParseMultiplicative());
+            } else {
+                return left;
+            }
+        }
+    }
+
+    std::size_t ParseMultiplicative() {
+        std::size_t left = ParseUnary();
+        for (;;) {
+            if (Accept("*")) {
+                left = Emit(BehaviourOpcode::Multiply, left, ParseUnary());
+            } else if (Accept("/")) {
+                left = Emit(BehaviourOpcode::Divide, left, ParseUnary());
+            } else {
+                return left;
+            }
+        }
+    }
+
+    std::size_t ParseUnary() {
+        if (Accept("-")) {
+            // Fold negative literals so "-1" is a constant, not an instruction
+            if (m_position < m_tokens.size() && m_tokens[m_position].kind == TokenKind::Number) {
+                return Constant(-m_tokens[m_position++].number);
+            }
+            return Emit(BehaviourOpcode::Negate, ParseUnary());
+        }
+        if (AcceptKeyword("not")) {
+            return Emit(BehaviourOpcode::Not, ParseUnary());
+        }
+        return ParsePrimary();
+    }
+
+    std::vector<std::size_t> ParseArguments(const std::string& function, std::size_t count) {
+        Expect("(");
+        std::vector<std::size_t> arguments;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i > 0) Expect(",");
+            arguments.push_back(ParseExpression());
+        }
+        if (!Accept(")")) {
+            throw std::invalid_argument(function + "() takes " + std::to_string(count) + " argument(s)");
+        }
+        return arguments;
+    }
+
+    std::size_t ParsePrimary() {
+        if (m_position >= m_tokens.size()) {
+            throw std::invalid_argument("expression ends early");
+        }
+
+        const Token token = m_tokens[m_position++];
+        if (token.kind == TokenKind::Number) {
+            return Constant(token.number);
+        }
+        if (IsSymbol(token, "(")) {
+            const std::size_t inner = ParseExpression();
+            Expect(")");
+            return inner;
+        }
+        if (token.kind != TokenKind::Name) {
+            throw std::invalid_argument("unexpected '" + token.text + "'");
+        }
+
+        static constexpr std::pair<const char*, BehaviourOpcode> UNARY_FUNCTIONS[] = {
+            {"abs", BehaviourOpcode::Absolute}, {"sign", BehaviourOpcode::Sign}, {"sin", BehaviourOpcode::Sine},
+        };
+        static constexpr std::pair<const char*, BehaviourOpcode> BINARY_FUNCTIONS[] = {
+            {"min", BehaviourOpcode::Minimum}, {"max", BehaviourOpcode::Maximum},
+        };
+        for (const auto& [name, opcode] : UNARY_FUNCTIONS) {
+            if (token.text == name) {
+                const auto arguments = ParseArguments(token.text, 1);
+                return Emit(opcode, arguments[0]);
+            }
+        }
+        for (const auto& [name, opcode] : BINARY_FUNCTIONS) {
+            if (token.text == name) {
+                const auto arguments = ParseArguments(token.text, 2);
+                return Emit(opcode, arguments[0], arguments[1]);
+            }
+        }
+        if (token.text == "select") {
+            const auto arguments = ParseArguments(token.text, 3);
+            return Emit(BehaviourOpcode::Select, arguments[0], arguments[1], arguments[2]);
+        }
+
+        return Lookup(token.text);
+    }
+};
+
+} // namespace
+
+// BehaviourProgram class implementation
+bool BehaviourProgram::Compile(const std::string& source, std::string& error) {
+    Clear();
+
+    std::vector<BehaviourInstruction> code;
+    std::vector<std::pair<std::uint8_t, float>> constants;
+    ScriptCompiler compiler(code, constants);
+
+    std::istringstream lines(source);
+    std::string line;
+    std::size_t lineNumber = 0;
+    while (std::getline(lines, line)) {
+        ++lineNumber;
+        try {
+            compiler.CompileLine(line);
+        } catch (const std::invalid_argument& e) {
+            error = "line " + std::to_string(lineNumber) + ": " + e.what();
+            return false;
+        }
+    }
+
+    if (code.empty()) {
+        error = "script has no statements";
+        return false;
+    }
+
+    m_code = std::move(code);
+    m_constants = std::move(constants);
+    m_registerCount = compiler.GetRegisterCount();
+    return true;
+}
+
+bool BehaviourProgram::LoadFromFile(const std::string& path, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        Clear();
+        error = "cannot open " + path;
+        return false;
+    }
+
+    std::ostringstream source;
+    source << file.rdbuf();
+    if (!Compile(source.str(), error)) {
+        error = path + ", " + error;
+        return false;
+    }
+    return true;
+}
+
+void BehaviourProgram::Clear() noexcept {
+    m_code.clear();
+    m_constants.clear();
+    m_registerCount = FIRST_FREE_REGISTER;
+}
+
+// BehaviourVM class implementation
+void BehaviourVM::Prepare(const BehaviourProgram& program, std::size_t laneCount) {
+    m_laneCount = laneCount;
+    m_registerCount = program.GetRegisterCount();
+    m_registers.resize(m_registerCount * m_laneCount);
+
+    // Outputs a script leaves alone read back as 0
+    std::fill(GetColumn(BehaviourProgram::FIRST_OUTPUT_REGISTER),
+              GetColumn(BehaviourProgram::FIRST_OUTPUT_REGISTER + BEHAVIOUR_OUTPUT_COUNT), 0.0f);
+}
+
+float* BehaviourVM::GetInput(BehaviourInput input) noexcept {
+    return GetColumn(InputRegister(input));
+}
+
+float* BehaviourVM::GetMemory(std::size_t slot) noexcept {
+    return GetColumn(BehaviourProgram::FIRST_MEMORY_REGISTER + slot);
+}
+
+const float* BehaviourVM::GetOutput(BehaviourOutput output) const noexcept {
+    return m_registers.data() + OutputRegister(output) * m_laneCount;
+}
+
+void BehaviourVM::SetUniform(BehaviourUniform uniform, float value) noexcept {
+    m_uniforms[static_cast<std::size_t>(uniform)] = value;
+}
+
+void BehaviourVM::Execute(const BehaviourProgram& program) noexcept {
+    if (m_laneCount == 0 || program.GetRegisterCount() != m_registerCount) return;
+
+    // Uniforms and constants become ordinary columns, so every opcode has one form
+    for (std::size_t i = 0; i < BEHAVIOUR_UNIFORM_COUNT; ++i) {
+        float* column = GetColumn(BehaviourProgram::FIRST_UNIFORM_REGISTER + i);
+        std::fill(column, column + m_laneCount, m_uniforms[i]);
+    }
+    for (const auto& [reg, value] : program.GetConstants()) {
+        float* column = GetColumn(reg);
+        std::fill(column, column + m_laneCount, value);
+    }
+
+    for (std::size_t first = 0; first < m_laneCount; first += LANE_BLOCK) {
+        ExecuteBlock(program, first, std::min(LANE_BLOCK, m_laneCount - first));
+    }
+}
+
+void BehaviourVM::ExecuteBlock(const BehaviourProgram& program, std::size_t first, std::size_t count) noexcept {
+    for (const BehaviourInstruction& instruction : program.GetCode()) {
+        float* d = GetColumn(instruction.destination) + first;
+        const float* a = GetColumn(instruction.a) + first;
+        const float* b = GetColumn(instruction.b) + first;
+        const float* c = GetColumn(instruction.c) + first;
+
+        // One dispatch per instruction, then a branch-free loop over the lanes
+        switch (instruction.opcode) {
+            case BehaviourOpcode::Copy:
+                for (std::size_t i = 0; i < count; ++i) d[i] = a[i];
+                break;
+            case BehaviourOpcode::Add:
+                for (std::size_t i = 0; i < count; ++i) d[i] = a[i] + b[i];
+                break;
+            case BehaviourOpcode::Subtract:
+                for (std::size_t i = 0; i < count; ++i) d[i] = a[i] - b[i];
+                break;
+            case BehaviourOpcode::Multiply:
+                for (std::size_t i = 0; i < count; ++i) d[i] = a[i] * b[i];
+                break;
+            case BehaviourOpcode::Divide:
+                for (std::size_t i = 0; i < count; ++i) d[i] = (b[i] != 0.0f) ? a[i] / b[i] : 0.0f;
+                break;
+            case BehaviourOpcode::Minimum:
+                for (std::size_t i = 0; i < count; ++i) d[i] = std::min(a[i], b[i]);
+                break;
+            case BehaviourOpcode::Maximum:
+                for (std::size_t i = 0; i < count; ++i) d[i] = std::max(a[i], b[i]);
+                break;
+            case BehaviourOpcode::Less:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] < b[i]);
+                break;
+            case BehaviourOpcode::LessEqual:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] <= b[i]);
+                break;
+            case BehaviourOpcode::Greater:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] > b[i]);
+                break;
+            case BehaviourOpcode::GreaterEqual:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] >= b[i]);
+                break;
+            case BehaviourOpcode::Equal:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] == b[i]);
+                break;
+            case BehaviourOpcode::NotEqual:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] != b[i]);
+                break;
+            case BehaviourOpcode::And:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>((a[i] != 0.0f) & (b[i] != 0.0f));
+                break;
+            case BehaviourOpcode::Or:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>((a[i] != 0.0f) | (b[i] != 0.0f));
+                break;
+            case BehaviourOpcode::Not:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] == 0.0f);
+                break;
+            case BehaviourOpcode::Negate:
+                for (std::size_t i = 0; i < count; ++i) d[i] = -a[i];
+                break;
+            case BehaviourOpcode::Absolute:
+                for (std::size_t i = 0; i < count; ++i) d[i] = std::abs(a[i]);
+                break;
+            case BehaviourOpcode::Sign:
+                for (std::size_t i = 0; i < count; ++i) d[i] = static_cast<float>(a[i] > 0.0f) - static_cast<float>(a[i] < 0.0f);
+                break;
+            case BehaviourOpcode::Sine:
+                for (std::size_t i = 0; i < count; ++i) d[i] = std::sin(a[i]);
+                break;
+            case BehaviourOpcode::Select:
+                for (std::size_t i = 0; i < count; ++i) d[i] = (a[i] != 0.0f) ? b[i] : c[i];
+                break;
+        }
+    }
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,290 @@
+#include "Benchmark.hpp"
+#include "raylib.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// The vendored raylib exposes its glad loader; a system raylib may not ship it
+#if __has_include("external/glad.h")
+    #include "external/glad.h"
+    #define PLAYASGOBO_HAS_GL_STRINGS 1
+#endif
+
+#if defined(__APPLE__)
+    #include <sys/sysctl.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/utsname.h>
+#endif
+
+namespace PlayAsGobo {
+
+namespace {
+
+constexpr double REFERENCE_FRAME_MICROSECONDS = 1.0e6 / 60.0;
+constexpr double SCORE_SCALE = 1000.0;
+constexpr double SCORE_PERCENTILE = 95.0;
+
+std::string QueryCpuName() {
+#if defined(__linux__)
+    std::ifstream cpuInfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuInfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            if (const std::size_t colon = line.find(':'); colon != std::string::npos) {
+                return line.substr(line.find_first_not_of(' ', colon + 1));
+            }
+        }
+    }
+#elif defined(__APPLE__)
+    char brand[256] = {};
+    std::size_t size = sizeof(brand);
+    if (sysctlbyname("machdep.cpu.brand_string", brand, &size, nullptr, 0) == 0) {
+        return brand;
+    }
+#elif defined(_WIN32)
+    if (const char* identifier = std::getenv("PROCESSOR_IDENTIFIER")) {
+        return identifier;
+    }
+#endif
+    return "unknown";
+}
+
+std::string QueryOperatingSystem() {
+#if defined(__unix__) || defined(__APPLE__)
+    utsname name{};
+    if (uname(&name) == 0) {
+        return std::string(name.sysname) + " " + name.release + " " + name.machine;
+    }
+#elif defined(_WIN32)
+    return "Windows";
+#endif
+    return "unknown";
+}
+
+std::string QueryGlString([[maybe_unused]] unsigned int name) {
+#ifdef PLAYASGOBO_HAS_GL_STRINGS
+    if (glad_glGetString != nullptr) {
+        if (const GLubyte* value = glGetString(name)) {
+            return reinterpret_cast<const char*>(value);
+        }
+    }
+#endif
+    return "unknown";
+}
+
+std::string EscapeJson(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char character : text) {
+        if (character == '"' || character == '\\') {
+            escaped += '\\';
+        }
+        escaped += (static_cast<unsigned char>(character) < 0x20) ? ' ' : character;
+    }
+    return escaped;
+}
+
+const char* GetBuildType() noexcept {
+#ifdef NDEBUG
+    return "Release";
+#else
+    return "Debug";
+#endif
+}
+
+} // namespace
+
+HardwareInfo HardwareInfo::Describe() {
+    HardwareInfo info;
+    info.cpu = QueryCpuName();
+    info.operatingSystem = QueryOperatingSystem();
+    info.hardwareThreads = std::thread::hardware_concurrency();
+
+#ifdef PLAYASGOBO_HAS_GL_STRINGS
+    info.gpu = QueryGlString(GL_RENDERER);
+    info.glVersion = QueryGlString(GL_VERSION);
+#else
+    info.gpu = "unknown";
+    info.glVersion = "unknown";
+#endif
+
+    const int monitor = GetCurrentMonitor();
+    info.screenWidth = GetMonitorWidth(monitor);
+    info.screenHeight = GetMonitorHeight(monitor);
+    info.refreshRate = GetMonitorRefreshRate(monitor);
+    return info;
+}
+
+void Benchmark::Start() noexcept {
+    for (LatencyHistogram& histogram : m_frameTimes) {
+        histogram.Reset();
+    }
+    m_phaseIndex = 0;
+    m_phaseTime = 0.0f;
+    m_elapsedTime = 0.0f;
+    m_explosionTimer = 0.0f;
+    m_explosionPending = false;
+    m_skipNextFrame = true;
+    m_isRunning = true;
+}
+
+void Benchmark::Cancel() noexcept {
+    m_isRunning = false;
+    m_explosionPending = false;
+}
+
+void Benchmark::RecordFrame(double frameSeconds) noexcept {
+    if (!m_isRunning) return;
+
+    if (m_skipNextFrame) {
+        m_skipNextFrame = false;
+        return;
+    }
+    m_frameTimes[m_phaseIndex].RecordSeconds(frameSeconds);
+}
+
+bool Benchmark::Advance(float deltaTime) noexcept {
+    if (!m_isRunning) return false;
+
+    const BenchmarkPhase& phase = BENCHMARK_PHASES[m_phaseIndex];
+    m_phaseTime += deltaTime;
+    m_elapsedTime += deltaTime;
+
+    if (phase.explosionInterval > 0.0f) {
+        m_explosionTimer += deltaTime;
+        if (m_explosionTimer >= phase.explosionInterval) {
+            m_explosionTimer -= phase.explosionInterval;
+            m_explosionPending = true;
+        }
+    }
+
+    if (m_phaseTime >= phase.duration) {
+        m_phaseTime = 0.0f;
+        m_explosionTimer = 0.0f;
+        if (++m_phaseIndex >= BENCHMARK_PHASE_COUNT) {
+            m_phaseIndex = BENCHMARK_PHASE_COUNT - 1;
+            m_isRunning = false;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Benchmark::ConsumeExplosionTrigger() noexcept {
+    const bool triggered = m_explosionPending;
+    m_explosionPending = false;
+    return triggered;
+}
+
+InputFrame Benchmark::GetScriptedInput(const InputFrame& liveInput) const noexcept {
+    // Gobo runs back and forth; the live Back button still cancels the run
+    constexpr std::uint8_t BACK_BIT = static_cast<std::uint8_t>(InputButton::Back);
+    const bool movingRight = static_cast<std::int32_t>(m_elapsedTime / SCRIPTED_TURN_INTERVAL) % 2 == 0;
+
+    InputFrame input;
+    input.held = static_cast<std::uint8_t>(movingRight ? InputButton::MoveRight : InputButton::MoveLeft);
+    input.held |= liveInput.held & BACK_BIT;
+    input.pressed = liveInput.pressed & BACK_BIT;
+    return input;
+}
+
+const BenchmarkPhase& Benchmark::GetCurrentPhase() const noexcept {
+    return BENCHMARK_PHASES[m_phaseIndex];
+}
+
+float Benchmark::GetProgress() const noexcept {
+    float totalDuration = 0.0f;
+    for (const BenchmarkPhase& phase : BENCHMARK_PHASES) {
+        totalDuration += phase.duration;
+    }
+    return std::min(m_elapsedTime / totalDuration, 1.0f);
+}
+
+double Benchmark::ComputeScore() const {
+    // Geometric mean, so no single phase dominates the number
+    double logSum = 0.0;
+    std::size_t phaseCount = 0;
+    for (const LatencyHistogram& histogram : m_frameTimes) {
+        if (histogram.IsEmpty()) continue;
+
+        const double p95 = std::max<double>(1.0, static_cast<double>(histogram.GetPercentileMicroseconds(SCORE_PERCENTILE)));
+        logSum += std::log(p95);
+        ++phaseCount;
+    }
+
+    if (phaseCount == 0) {
+        return 0.0;
+    }
+    return SCORE_SCALE * REFERENCE_FRAME_MICROSECONDS / std::exp(logSum / static_cast<double>(phaseCount));
+}
+
+void Benchmark::WriteSummary(std::ostream& stream, const HardwareInfo& hardware) const {
+    const std::ios_base::fmtflags flags = stream.flags();
+    const std::streamsize precision = stream.precision();
+
+    stream << std::fixed << std::setprecision(2);
+    stream << "Benchmark score: " << ComputeScore() << " (" << GetBuildType() << " build, higher is better)\n";
+    stream << "  CPU: " << hardware.cpu << " (" << hardware.hardwareThreads << " threads)\n";
+    stream << "  GPU: " << hardware.gpu << " / OpenGL " << hardware.glVersion << "\n";
+    stream << "  OS:  " << hardware.operatingSystem << ", display " << hardware.screenWidth << "x"
+           << hardware.screenHeight << " @ " << hardware.refreshRate << " Hz\n";
+    stream << "  Frame times in ms:\n";
+
+    for (std::size_t i = 0; i < BENCHMARK_PHASE_COUNT; ++i) {
+        const LatencyHistogram& histogram = m_frameTimes[i];
+        stream << "    " << std::left << std::setw(8) << BENCHMARK_PHASES[i].name << std::right
+               << " frames " << std::setw(5) << histogram.GetTotalCount()
+               << "  mean " << std::setw(7) << histogram.GetMeanMicroseconds() / 1000.0
+               << "  p50 " << std::setw(7) << histogram.GetPercentileMicroseconds(50.0) / 1000.0
+               << "  p95 " << std::setw(7) << histogram.GetPercentileMicroseconds(95.0) / 1000.0
+               << "  p99 " << std::setw(7) << histogram.GetPercentileMicroseconds(99.0) / 1000.0
+               << "  max " << std::setw(7) << histogram.GetMaxMicroseconds() / 1000.0 << "\n";
+    }
+    stream << std::flush;
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+bool Benchmark::SaveReport(const std::string& path, const HardwareInfo& hardware) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Warning: Could not write benchmark report to " << path << std::endl;
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"score\":" << ComputeScore()
+         << ",\"seed\":" << SCENE_SEED
+         << ",\"fixedStepHz\":" << std::lround(1.0f / FIXED_DELTA_TIME)
+         << ",\"build\":\"" << GetBuildType() << "\""
+         << ",\"hardware\":{\"cpu\":\"" << EscapeJson(hardware.cpu)
+         << "\",\"threads\":" << hardware.hardwareThreads
+         << ",\"gpu\":\"" << EscapeJson(hardware.gpu)
+         << "\",\"glVersion\":\"" << EscapeJson(hardware.glVersion)
+         << "\",\"os\":\"" << EscapeJson(hardware.operatingSystem)
+         << "\",\"display\":\"" << hardware.screenWidth << "x" << hardware.screenHeight
+         << "@" << hardware.refreshRate << "\"}"
+         << ",\"unit\":\"ms\",\"phases\":[";
+
+    for (std::size_t i = 0; i < BENCHMARK_PHASE_COUNT; ++i) {
+        const LatencyHistogram& histogram = m_frameTimes[i];
+        file << (i == 0 ? "" : ",") << "{\"name\":\"" << BENCHMARK_PHASES[i].name << "\""
+             << ",\"count\":" << histogram.GetTotalCount()
+             << ",\"mean\":" << histogram.GetMeanMicroseconds() / 1000.0
+             << ",\"p50\":" << histogram.GetPercentileMicroseconds(50.0) / 1000.0
+             << ",\"p95\":" << histogram.GetPercentileMicroseconds(95.0) / 1000.0
+             << ",\"p99\":" << histogram.GetPercentileMicroseconds(99.0) / 1000.0
+             << ",\"max\":" << histogram.GetMaxMicroseconds() / 1000.0 << "}";
+    }
+
+    file << "]}\n";
+    return static_cast<bool>(file);
+}
+
+} // namespace PlayAsGobo
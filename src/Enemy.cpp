@@ -1,5 +1,6 @@
 #include "Enemy.hpp"
 #include "Player.hpp"
+#include "ProjectileSystem.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <cmath>
@@ -9,28 +10,31 @@ namespace PlayAsGobo {
 
 Enemy::Enemy(float x, float y, float radius,
              const std::vector<Texture2D>& enemyTextures,
-             float speed, EnemyDirection initialDirection)
+             float speed, EnemyDirection initialDirection,
+             EnemyArchetype archetype)
     : Entity(x, y, radius)
-    , m_textures(enemyTextures)
+    , m_textures(&enemyTextures)
     , m_moveSpeed(speed)
-    , m_direction(initialDirection) {
+    , m_direction(initialDirection)
+    , m_archetype(archetype)
+    , m_gravityScale(GetEnemyArchetypeParams(archetype).gravityScale) {
     
     ValidateTextures();
     ValidateSpeed(speed);
 }
 
 void Enemy::ValidateTextures() const {
-    if (m_textures.empty()) {
+    if (m_textures->empty()) {
         throw std::invalid_argument("Enemy textures cannot be empty");
     }
     
-    if (m_textures.size() < 4) {
+    if (m_textures->size() < 4) {
         throw std::invalid_argument("Enemy requires at least 4 texture frames (idle + 3 running)");
     }
     
     // Validate that textures are actually loaded
-    for (std::size_t i = 0; i < m_textures.size(); ++i) {
-        if (m_textures[i].id == 0) {
+    for (std::size_t i = 0; i < m_textures->size(); ++i) {
+        if ((*m_textures)[i].id == 0) {
             throw std::invalid_argument("Enemy texture at index " + std::to_string(i) + 
                                       " is not properly loaded");
         }
@@ -110,18 +114,161 @@ void Enemy::HandlePlayerProximityJump(const Player& player) {
     }
 }
 
-void Enemy::ExecuteAI(float deltaTime, float mapWidth, float finishLineX,
-                     const Player& player, [[maybe_unused]] bool soundEnabled) {
-    if (deltaTime <= 0.0f) {
-        std::cerr << "Warning: Invalid deltaTime passed to Enemy::ExecuteAI" << std::endl;
+void Enemy::HandleTimedHop(float deltaTime, float hopInterval) noexcept {
+    m_behaviourTimer += deltaTime;
+    
+    if (m_isOnGround && m_behaviourTimer >= hopInterval) {
+        Jump();
+        m_behaviourTimer = 0.0f;
+    }
+}
+
+void Enemy::HandleThrow(float deltaTime, float throwInterval, float gravity,
+                        const Player& player, ProjectileSystem& projectiles) noexcept {
+    m_throwTimer += deltaTime;
+    if (m_throwTimer < throwInterval) return;
+    
+    // Stay charged while Gobo is out of range so the throw comes as soon as Gobo is in it
+    if (std::abs(player.GetX() - GetX()) > THROW_RANGE) return;
+    
+    ThrowAt(player, gravity, projectiles);
+    m_throwTimer = 0.0f;
+}
+
+void Enemy::ThrowAt(const Player& player, float gravity, ProjectileSystem& projectiles) noexcept {
+    const Vector2 origin = {GetX(), GetY() - GetRadius()};
+    const Vector2 target = player.GetCenter();
+    const float deltaX = target.x - origin.x;
+    
+    // Lob at a fixed horizontal speed, with the vertical speed that puts the arc through Gobo
+    const float flightTime = std::max(std::abs(deltaX) / THROW_SPEED, MIN_THROW_FLIGHT_TIME);
+    const float projectileGravity = gravity * THROW_GRAVITY_SCALE;
+    const Vector2 velocity = {
+        deltaX / flightTime,
+        (target.y - origin.y) / flightTime - 0.5f * projectileGravity * flightTime
+    };
+    
+    projectiles.Spawn(ProjectileOwner::Enemy, origin, velocity, THROW_RADIUS, THROW_LIFETIME, THROW_GRAVITY_SCALE);
+}
+
+void Enemy::UpdateHover(float deltaTime, float groundY) noexcept {
+    m_behaviourTimer += deltaTime;
+    
+    // Steer towards a bobbing altitude; this also damps any knock-back impulse
+    const float targetY = groundY - FLYER_HOVER_HEIGHT - GetRadius() +
+                          std::sin(m_behaviourTimer * FLYER_BOB_SPEED) * FLYER_BOB_AMPLITUDE;
+    m_velocityY = (targetY - GetY()) * FLYER_STEERING;
+    m_isOnGround = false;
+}
+
+template<EnemyArchetype Archetype>
+void Enemy::ExecuteAIBatch(Enemy* const* enemies, std::size_t count, const EnemyAIContext& context) noexcept {
+    using Traits = EnemyArchetypeTraits<Archetype>;
+    
+    if (context.deltaTime <= 0.0f || !context.player) {
+        return;
+    }
+    
+    for (std::size_t i = 0; i < count; ++i) {
+        Enemy& enemy = *enemies[i];
+        
+        // Update movement based on finish line position
+        enemy.UpdateMovement(context.deltaTime, context.mapWidth, context.finishLineX);
+        
+        if constexpr (Traits::FLIES) {
+            enemy.UpdateHover(context.deltaTime, context.groundY);
+        }
+        if constexpr (Traits::HOP_INTERVAL > 0.0f) {
+            enemy.HandleTimedHop(context.deltaTime, Traits::HOP_INTERVAL);
+        }
+        if constexpr (Traits::JUMPS_AT_PLAYER) {
+            // Handle jumping when player is nearby
+            enemy.HandlePlayerProximityJump(*context.player);
+        }
+        if constexpr (Traits::THROW_INTERVAL > 0.0f) {
+            if (context.projectiles) {
+                enemy.HandleThrow(context.deltaTime, Traits::THROW_INTERVAL, context.gravity,
+                                  *context.player, *context.projectiles);
+            }
+        }
+    }
+}
+
+template void Enemy::ExecuteAIBatch<EnemyArchetype::Walker>(Enemy* const*, std::size_t, const EnemyAIContext&) noexcept;
+template void Enemy::ExecuteAIBatch<EnemyArchetype::Jumper>(Enemy* const*, std::size_t, const EnemyAIContext&) noexcept;
+template void Enemy::ExecuteAIBatch<EnemyArchetype::Flyer>(Enemy* const*, std::size_t, const EnemyAIContext&) noexcept;
+template void Enemy::ExecuteAIBatch<EnemyArchetype::Heavy>(Enemy* const*, std::size_t, const EnemyAIContext&) noexcept;
+
+void Enemy::ExecuteScriptedAIBatch(Enemy* const* enemies, std::size_t count, const BehaviourProgram& program,
+                                   BehaviourVM& vm, const EnemyAIContext& context) {
+    if (count == 0 || context.deltaTime <= 0.0f || !context.player || !program.IsValid()) {
         return;
     }
     
-    // Update movement based on finish line position
-    UpdateMovement(deltaTime, mapWidth, finishLineX);
+    // Gather the batch into the VM's columns
+    vm.Prepare(program, count);
+    float* const x = vm.GetInput(BehaviourInput::X);
+    float* const y = vm.GetInput(BehaviourInput::Y);
+    float* const radius = vm.GetInput(BehaviourInput::Radius);
+    float* const onGround = vm.GetInput(BehaviourInput::OnGround);
+    float* const facing = vm.GetInput(BehaviourInput::Facing);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Enemy& enemy = *enemies[i];
+        x[i] = enemy.GetX();
+        y[i] = enemy.GetY();
+        radius[i] = enemy.GetRadius();
+        onGround[i] = enemy.m_isOnGround ? 1.0f : 0.0f;
+        facing[i] = (enemy.m_direction == EnemyDirection::Right) ? 1.0f : -1.0f;
+    }
+    for (std::size_t slot = 0; slot < BEHAVIOUR_MEMORY_COUNT; ++slot) {
+        float* const memory = vm.GetMemory(slot);
+        for (std::size_t i = 0; i < count; ++i) {
+            memory[i] = enemies[i]->m_behaviourMemory[slot];
+        }
+    }
     
-    // Handle jumping when player is nearby
-    HandlePlayerProximityJump(player);
+    vm.SetUniform(BehaviourUniform::DeltaTime, context.deltaTime);
+    vm.SetUniform(BehaviourUniform::PlayerX, context.player->GetX());
+    vm.SetUniform(BehaviourUniform::PlayerY, context.player->GetY());
+    vm.SetUniform(BehaviourUniform::FinishX, context.finishLineX);
+    vm.SetUniform(BehaviourUniform::MapWidth, context.mapWidth);
+    vm.SetUniform(BehaviourUniform::GroundY, context.groundY);
+    
+    vm.Execute(program);
+    
+    // Apply the decisions
+    const float* const move = vm.GetOutput(BehaviourOutput::Move);
+    const float* const jump = vm.GetOutput(BehaviourOutput::Jump);
+    const float* const shouldThrow = vm.GetOutput(BehaviourOutput::Throw);
+    const float* const fly = vm.GetOutput(BehaviourOutput::Fly);
+    const float* const velocityY = vm.GetOutput(BehaviourOutput::VelocityY);
+    for (std::size_t i = 0; i < count; ++i) {
+        Enemy& enemy = *enemies[i];
+        
+        const float step = std::clamp(move[i], -1.0f, 1.0f);
+        enemy.m_isMoving = (step != 0.0f);
+        if (enemy.m_isMoving) {
+            enemy.m_direction = (step > 0.0f) ? EnemyDirection::Right : EnemyDirection::Left;
+            enemy.SetX(enemy.GetX() + step * enemy.m_moveSpeed * context.deltaTime);
+        }
+        
+        if (fly[i] != 0.0f) {
+            enemy.m_velocityY = velocityY[i];
+            enemy.m_isOnGround = false;
+        }
+        if (jump[i] != 0.0f && enemy.m_isOnGround) {
+            enemy.Jump();
+        }
+        if (shouldThrow[i] != 0.0f && context.projectiles) {
+            enemy.ThrowAt(*context.player, context.gravity, *context.projectiles);
+        }
+    }
+    for (std::size_t slot = 0; slot < BEHAVIOUR_MEMORY_COUNT; ++slot) {
+        const float* const memory = vm.GetMemory(slot);
+        for (std::size_t i = 0; i < count; ++i) {
+            enemies[i]->m_behaviourMemory[slot] = memory[i];
+        }
+    }
 }
 
 void Enemy::UpdateAnimation(float deltaTime) {
@@ -167,15 +314,15 @@ void Enemy::Update(float deltaTime) {
 void Enemy::Draw(std::int32_t textureResolution, 
                 [[maybe_unused]] std::int32_t windowHeight, 
                 [[maybe_unused]] std::int32_t windowWidth) const {
-    if (m_textures.empty()) {
+    if (m_textures->empty()) {
         std::cerr << "Warning: No textures available for enemy rendering" << std::endl;
         return;
     }
     
     const std::size_t frameIndex = static_cast<std::size_t>(m_currentFrame);
-    if (frameIndex >= m_textures.size()) {
+    if (frameIndex >= m_textures->size()) {
         std::cerr << "Warning: Invalid frame index " << frameIndex << 
-                     " for enemy animation (max: " << m_textures.size() - 1 << ")" << std::endl;
+                     " for enemy animation (max: " << m_textures->size() - 1 << ")" << std::endl;
         return;
     }
     
@@ -201,8 +348,8 @@ void Enemy::Draw(std::int32_t textureResolution,
     };
     
     // Draw the enemy texture
-    DrawTexturePro(m_textures[frameIndex], sourceRect, destRect,
-                   Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+    DrawTexturePro((*m_textures)[frameIndex], sourceRect, destRect,
+                   Vector2{0.0f, 0.0f}, 0.0f, GetEnemyArchetypeParams(m_archetype).tint);
 }
 
 } // namespace PlayAsGobo
\ No newline at end of file
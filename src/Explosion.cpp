@@ -1,4 +1,6 @@
 #include "Explosion.hpp"
+#include "AudioCommands.hpp"
+#include "rlgl.h"
 #include <stdexcept>
 #include <algorithm>
 #include <random>
@@ -66,7 +68,7 @@ void Explosion::Start(Vector2 position, bool soundEnabled) {
     
     // Play explosion sound
     if (soundEnabled && m_sound.frameCount > 0) {
-        PlaySound(m_sound);
+        AudioCommands::PlaySound(m_sound);
     }
     
     CreateParticles();
@@ -172,8 +174,16 @@ float Explosion::GetRadius() const noexcept {
     return progress * m_maxRadius;
 }
 
+float Explosion::GetDamagePhaseDuration() const noexcept {
+    return std::min(DAMAGE_PHASE_DURATION, m_maxDuration);
+}
+
 float Explosion::GetDamageRadius() const noexcept {
-    return m_isActive ? GetRadius() : 0.0f;
+    if (!IsInDamagePhase()) return 0.0f;
+    
+    // The blast front reaches full size within the damage window, so the
+    // shorter window doesn't shrink the area a bomb clears
+    return std::min(m_timer / GetDamagePhaseDuration(), 1.0f) * m_maxRadius;
 }
 
 float Explosion::GetProgress() const noexcept {
@@ -183,7 +193,14 @@ float Explosion::GetProgress() const noexcept {
 }
 
 bool Explosion::IsInDamagePhase() const noexcept {
-    return m_isActive;
+    return GetPhase() == ExplosionPhase::Damage;
+}
+
+ExplosionPhase Explosion::GetPhase() const noexcept {
+    if (!m_isActive) return ExplosionPhase::Retired;
+    if (m_timer <= 0.0f) return ExplosionPhase::Arming;
+    if (m_timer < GetDamagePhaseDuration()) return ExplosionPhase::Damage;
+    return ExplosionPhase::VisualTail;
 }
 
 void Explosion::DrawExplosionCore() const {
@@ -195,15 +212,28 @@ void Explosion::DrawExplosionCore() const {
     const Color explosionColor = {255, 100, 0, static_cast<unsigned char>(255 * alpha)};
     DrawCircle(static_cast<int>(m_position.x), static_cast<int>(m_position.y), 
               radius, explosionColor);
+}
+
+void Explosion::AddLights(LightBuffer& lights) const {
+    if (!m_isActive) return;
     
-    // Inner bright circle (only during early phase)
-    if (m_timer < DAMAGE_PHASE_DURATION) {
-        const float innerAlpha = 1.0f - (m_timer / DAMAGE_PHASE_DURATION);
-        const Color innerColor = {255, 255, 255, static_cast<unsigned char>(255 * innerAlpha)};
-        const float innerRadius = radius * 0.5f;
-        
-        DrawCircle(static_cast<int>(m_position.x), static_cast<int>(m_position.y), 
-                  innerRadius, innerColor);
+    // Warm glow a little wider than the blast, fading with it
+    const float alpha = 1.0f - GetProgress();
+    const float coreRadius = std::max(GetRadius(), m_maxRadius * 0.25f) * CORE_LIGHT_SCALE;
+    lights.AddLight(m_position, coreRadius, {255, 120, 30, static_cast<unsigned char>(255 * alpha)});
+    
+    // White flash marks the blast front while it can still do damage
+    if (IsInDamagePhase()) {
+        const float innerAlpha = 1.0f - (m_timer / GetDamagePhaseDuration());
+        lights.AddLight(m_position, GetDamageRadius() * CORE_LIGHT_SCALE,
+                        {255, 255, 255, static_cast<unsigned char>(255 * innerAlpha)});
+    }
+    
+    // Only the white and yellow particles are hot enough to glow
+    for (const auto& particle : m_particles) {
+        if (particle.life > 0.0f && particle.life > particle.maxLife * HOT_PARTICLE_LIFE_RATIO) {
+            lights.AddLight(particle.position, particle.size * PARTICLE_LIGHT_SCALE, particle.color);
+        }
     }
 }
 
@@ -224,6 +254,25 @@ void Explosion::Draw() const {
     DrawParticles();
 }
 
+float Explosion::GetGlowRadius() const noexcept {
+    // Covers the core and every live particle, so the glow spans what Draw() would
+    float radius = GetRadius();
+    for (const auto& particle : m_particles) {
+        if (particle.life > 0.0f) {
+            radius = std::max(radius, Vector2Distance(particle.position, m_position) + particle.size);
+        }
+    }
+    return radius;
+}
+
+void Explosion::AppendGlowQuad(QuadWriter& quads) const {
+    if (!m_isActive) return;
+    
+    const float radius = GetGlowRadius();
+    const float alpha = 1.0f - GetProgress();
+    quads.Add(m_position, radius, {255, 140, 40, static_cast<unsigned char>(255 * alpha)});
+}
+
 void Explosion::SetMaxDuration(float duration) {
     ValidateDuration(duration);
     m_maxDuration = duration;
@@ -251,14 +300,14 @@ void ExplosionManager::ValidateMaxExplosions(std::size_t maxCount) const {
 
 Explosion* ExplosionManager::FindInactiveExplosion() noexcept {
     for (auto& explosion : m_explosions) {
-        if (explosion && !explosion->IsActive()) {
-            return explosion.get();
+        if (!explosion.IsActive()) {
+            return &explosion;
         }
     }
     return nullptr;
 }
 
-void ExplosionManager::CreateNewExplosion(Vector2 position, const Sound& explosionSound, bool soundEnabled) {
+Explosion* ExplosionManager::CreateNewExplosion(Vector2 position, const Sound& explosionSound, bool soundEnabled) {
     // Remove old explosions if we're at the limit
     if (m_explosions.size() >= m_maxExplosions) {
         CleanupInactiveExplosions();
@@ -266,66 +315,107 @@ void ExplosionManager::CreateNewExplosion(Vector2 position, const Sound& explosi
     
     // Only create new explosion if we still have room
     if (m_explosions.size() < m_maxExplosions) {
-        auto explosion = std::make_unique<Explosion>(explosionSound);
-        explosion->Start(position, soundEnabled);
-        m_explosions.push_back(std::move(explosion));
-    } else {
-        std::cerr << "Warning: Max explosion limit (" << m_maxExplosions 
-                  << ") reached. Skipping explosion creation." << std::endl;
+        // Reserve the whole budget up front so growing never relocates explosions
+        if (m_explosions.capacity() < m_maxExplosions) {
+            m_explosions.reserve(m_maxExplosions);
+            m_damageQueries.reserve(m_maxExplosions);
+        }
+        Explosion& explosion = m_explosions.emplace_back(explosionSound);
+        explosion.Start(position, soundEnabled);
+        return &explosion;
     }
+    
+    std::cerr << "Warning: Max explosion limit (" << m_maxExplosions 
+              << ") reached. Skipping explosion creation." << std::endl;
+    return nullptr;
 }
 
 void ExplosionManager::CleanupInactiveExplosions() {
     m_explosions.erase(
         std::remove_if(m_explosions.begin(), m_explosions.end(),
-                      [](const std::unique_ptr<Explosion>& explosion) {
-                          return !explosion || !explosion->IsActive();
+                      [](const Explosion& explosion) {
+                          return !explosion.IsActive();
                       }),
         m_explosions.end()
-    );
+    );    
+    // Erasing shifted the indices
+    RebuildDamageQueries();
+}
+
+void ExplosionManager::RebuildDamageQueries() {
+    m_damageQueries.clear();
+    for (std::size_t i = 0; i < m_explosions.size(); ++i) {
+        if (m_explosions[i].IsInDamagePhase()) {
+            m_damageQueries.push_back(i);
+        }
+    }
 }
 
 void ExplosionManager::CreateExplosion(Vector2 position, const Sound& explosionSound, bool soundEnabled) {
     // Try to reuse an inactive explosion
     if (Explosion* inactiveExplosion = FindInactiveExplosion()) {
         inactiveExplosion->Start(position, soundEnabled);
+        m_pendingImpacts.push_back({position, inactiveExplosion->GetMaxRadius()});
         return;
     }
     
     // Create new explosion if no inactive ones available
-    CreateNewExplosion(position, explosionSound, soundEnabled);
+    if (const Explosion* newExplosion = CreateNewExplosion(position, explosionSound, soundEnabled)) {
+        m_pendingImpacts.push_back({position, newExplosion->GetMaxRadius()});
+    }
 }
 
 void ExplosionManager::Update(float deltaTime) {
     if (deltaTime <= 0.0f) return;
     
     for (auto& explosion : m_explosions) {
-        if (explosion) {
-            explosion->Update(deltaTime);
-        }
+        explosion.Update(deltaTime);
     }
+    
+    // Explosions past their damage window stay in m_explosions for rendering only
+    RebuildDamageQueries();
 }
 
 void ExplosionManager::Draw() const {
     for (const auto& explosion : m_explosions) {
-        if (explosion) {
-            explosion->Draw();
-        }
+        explosion.Draw();
+    }
+}
+
+void ExplosionManager::DrawGlow(const Texture2D& glowSprite) const {
+    rlSetTexture(glowSprite.id != 0 ? glowSprite.id : rlGetTextureIdDefault());
+    rlBegin(RL_QUADS);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    QuadWriter quads;
+    quads.Begin();
+    for (const auto& explosion : m_explosions) {
+        explosion.AppendGlowQuad(quads);
+    }
+    quads.Finish();
+    rlEnd();
+    rlSetTexture(0);
+}
+
+void ExplosionManager::AddLights(LightBuffer& lights) const {
+    for (const auto& explosion : m_explosions) {
+        explosion.AddLights(lights);
     }
 }
 
 void ExplosionManager::Clear() noexcept {
-    m_explosions.clear();
+    // Deactivate instead of destroying so particle storage is reused next session
+    for (auto& explosion : m_explosions) {
+        explosion.Reset();
+    }
+    m_pendingImpacts.clear();
+    m_damageQueries.clear();
 }
 
 bool ExplosionManager::CheckExplosionDamage(Vector2 position, float radius) const noexcept {
-    for (const auto& explosion : m_explosions) {
-        if (!explosion || !explosion->IsInDamagePhase()) {
-            continue;
-        }
-        
-        const float distance = Vector2Distance(explosion->GetPosition(), position);
-        const float totalRadius = explosion->GetDamageRadius() + radius;
+    for (const std::size_t index : m_damageQueries) {
+        const Explosion& explosion = m_explosions[index];
+        const float distance = Vector2Distance(explosion.GetPosition(), position);
+        const float totalRadius = explosion.GetDamageRadius() + radius;
         if (distance < totalRadius) {
             return true;
         }
@@ -338,8 +428,8 @@ std::vector<Vector2> ExplosionManager::GetActiveExplosionPositions() const {
     positions.reserve(m_explosions.size());
     
     for (const auto& explosion : m_explosions) {
-        if (explosion && explosion->IsActive()) {
-            positions.push_back(explosion->GetPosition());
+        if (explosion.IsActive()) {
+            positions.push_back(explosion.GetPosition());
         }
     }
     
@@ -348,15 +438,15 @@ std::vector<Vector2> ExplosionManager::GetActiveExplosionPositions() const {
 
 std::size_t ExplosionManager::GetActiveExplosionCount() const noexcept {
     return std::count_if(m_explosions.begin(), m_explosions.end(),
-                        [](const std::unique_ptr<Explosion>& explosion) {
-                            return explosion && explosion->IsActive();
+                        [](const Explosion& explosion) {
+                            return explosion.IsActive();
                         });
 }
 
 bool ExplosionManager::HasActiveExplosions() const noexcept {
     return std::any_of(m_explosions.begin(), m_explosions.end(),
-                      [](const std::unique_ptr<Explosion>& explosion) {
-                          return explosion && explosion->IsActive();
+                      [](const Explosion& explosion) {
+                          return explosion.IsActive();
                       });
 }
 
@@ -372,6 +462,7 @@ void ExplosionManager::SetMaxExplosions(std::size_t maxCount) {
         while (m_explosions.size() > m_maxExplosions) {
             m_explosions.erase(m_explosions.begin());
         }
+        RebuildDamageQueries();
     }
 }
 
@@ -280,10 +280,10 @@ Rectangle FinishLine::CalculateClippedSourceRect(const Rectangle& sourceRect,
     return clippedSource;
 }
 
-void FinishLine::DrawTile(float textureWidth, float textureHeight,
-                         std::int32_t tileX, std::int32_t tileY) const {
-    const Rectangle sourceRect = {0.0f, 0.0f, textureWidth, textureHeight};
-    const Rectangle destRect = {
+bool FinishLine::ComputeTile(float textureWidth, float textureHeight, std::int32_t tileX, std::int32_t tileY,
+                             Rectangle& destRect, Rectangle& sourceRect) const noexcept {
+    const Rectangle fullSourceRect = {0.0f, 0.0f, textureWidth, textureHeight};
+    const Rectangle fullDestRect = {
         m_bounds.x + tileX * textureWidth,
         m_bounds.y + tileY * textureHeight,
         textureWidth,
@@ -291,18 +291,45 @@ void FinishLine::DrawTile(float textureWidth, float textureHeight,
     };
     
     // Clip destination rectangle to finish line bounds
-    const Rectangle clippedDestRect = CalculateClippedDestRect(destRect);
+    destRect = CalculateClippedDestRect(fullDestRect);
     
     // Skip if tile is completely outside bounds
-    if (clippedDestRect.width <= 0.0f || clippedDestRect.height <= 0.0f) {
-        return;
+    if (destRect.width <= 0.0f || destRect.height <= 0.0f) {
+        return false;
     }
     
     // Calculate corresponding source rectangle for clipped destination
-    const Rectangle clippedSourceRect = CalculateClippedSourceRect(sourceRect, destRect, clippedDestRect);
+    sourceRect = CalculateClippedSourceRect(fullSourceRect, fullDestRect, destRect);
+    return true;
+}
+
+void FinishLine::DrawTile(float textureWidth, float textureHeight,
+                          std::int32_t tileX, std::int32_t tileY) const {
+    Rectangle destRect;
+    Rectangle sourceRect;
+    if (ComputeTile(textureWidth, textureHeight, tileX, tileY, destRect, sourceRect)) {
+        DrawTexturePro(m_texture, sourceRect, destRect, Vector2{0.0f, 0.0f}, 0.0f, GetCurrentTintColor());
+    }
+}
+
+void FinishLine::CollectTiles(std::vector<StaticTile>& tiles) const {
+    if (!m_hasTexture || m_texture.width <= 0 || m_texture.height <= 0) return;
     
-    DrawTexturePro(m_texture, clippedSourceRect, clippedDestRect, 
-                   Vector2{0.0f, 0.0f}, 0.0f, GetCurrentTintColor());
+    const float textureWidth = static_cast<float>(m_texture.width);
+    const float textureHeight = static_cast<float>(m_texture.height);
+    
+    std::int32_t tilesX, tilesY;
+    CalculateTileLayout(textureWidth, textureHeight, tilesX, tilesY);
+    
+    for (std::int32_t x = 0; x < tilesX; ++x) {
+        for (std::int32_t y = 0; y < tilesY; ++y) {
+            StaticTile tile{};
+            if (ComputeTile(textureWidth, textureHeight, x, y, tile.destination, tile.source)) {
+                tile.tint = GetCurrentTintColor();
+                tiles.push_back(tile);
+            }
+        }
+    }
 }
 
 void FinishLine::DrawAnimatedTile(float textureWidth, float textureHeight,
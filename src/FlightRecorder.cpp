@@ -0,0 +1,279 @@
+#include "FlightRecorder.hpp"
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace PlayAsGobo {
+
+namespace {
+
+// Signal handlers cannot capture state, so the installed recorder is published here
+std::atomic<FlightRecorder*> s_activeRecorder{nullptr};
+volatile std::sig_atomic_t s_isDumping = 0;
+
+constexpr std::array<int, 4> CRASH_SIGNALS = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+
+#if defined(_WIN32)
+using SignalHandler = void (*)(int);
+std::array<SignalHandler, CRASH_SIGNALS.size()> s_previousHandlers{};
+
+int OpenDumpFile(const char* path) noexcept {
+    return _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+}
+
+bool WriteAll(int fd, const void* data, std::size_t size) noexcept {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        const int written = _write(fd, bytes, static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 20)));
+        if (written <= 0) return false;
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+void CloseDumpFile(int fd) noexcept {
+    _close(fd);
+}
+#else
+std::array<struct sigaction, CRASH_SIGNALS.size()> s_previousActions{};
+
+// Separate stack so a stack overflow can still be reported
+alignas(16) char s_signalStack[64 * 1024];
+
+int OpenDumpFile(const char* path) noexcept {
+    return open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+}
+
+bool WriteAll(int fd, const void* data, std::size_t size) noexcept {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t written = write(fd, bytes, size);
+        if (written <= 0) return false;
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+void CloseDumpFile(int fd) noexcept {
+    close(fd);
+}
+#endif
+
+// strlen/strncpy are not guaranteed async-signal-safe everywhere
+std::size_t CopyString(char* destination, std::size_t capacity, const char* source) noexcept {
+    std::size_t length = 0;
+    if (source) {
+        while (length + 1 < capacity && source[length] != '\0') {
+            destination[length] = source[length];
+            ++length;
+        }
+    }
+    destination[length] = '\0';
+    return length;
+}
+
+void WriteStderr(const char* text) noexcept {
+    std::size_t length = 0;
+    while (text[length] != '\0') ++length;
+#if defined(_WIN32)
+    (void)WriteAll(2, text, length);
+#else
+    (void)WriteAll(STDERR_FILENO, text, length);
+#endif
+}
+
+} // namespace
+
+FlightRecorder::FlightRecorder(std::size_t capacity)
+    : m_capacity(capacity) {
+    ValidateCapacity(capacity);
+    m_records = std::make_unique<FlightRecord[]>(capacity);
+}
+
+FlightRecorder::~FlightRecorder() {
+    Uninstall();
+}
+
+void FlightRecorder::ValidateCapacity(std::size_t capacity) const {
+    if (capacity < MIN_CAPACITY || capacity > MAX_CAPACITY) {
+        throw std::invalid_argument("FlightRecorder capacity must be between " +
+                                  std::to_string(MIN_CAPACITY) + " and " +
+                                  std::to_string(MAX_CAPACITY));
+    }
+}
+
+void FlightRecorder::FillMagic(std::array<char, 8>& magic) noexcept {
+    constexpr char MAGIC[8] = {'G', 'O', 'B', 'O', 'F', 'L', 'T', '\0'};
+    for (std::size_t i = 0; i < magic.size(); ++i) {
+        magic[i] = MAGIC[i];
+    }
+}
+
+void FlightRecorder::Install(const std::string& dumpPath) {
+    if (dumpPath.size() + 1 > m_dumpPath.size()) {
+        throw std::invalid_argument("FlightRecorder dump path cannot exceed " +
+                                  std::to_string(m_dumpPath.size() - 1) + " characters");
+    }
+
+    FlightRecorder* expected = nullptr;
+    if (!s_activeRecorder.compare_exchange_strong(expected, this)) {
+        if (expected != this) {
+            std::cerr << "Warning: Another flight recorder is already installed" << std::endl;
+        }
+        return;
+    }
+
+    CopyString(m_dumpPath.data(), m_dumpPath.size(), dumpPath.c_str());
+
+#if defined(_WIN32)
+    for (std::size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        s_previousHandlers[i] = std::signal(CRASH_SIGNALS[i], &FlightRecorder::HandleSignal);
+    }
+#else
+    stack_t signalStack{};
+    signalStack.ss_sp = s_signalStack;
+    signalStack.ss_size = sizeof(s_signalStack);
+    if (sigaltstack(&signalStack, nullptr) != 0) {
+        std::cerr << "Warning: Could not install alternate signal stack" << std::endl;
+    }
+
+    struct sigaction action{};
+    action.sa_handler = &FlightRecorder::HandleSignal;
+    action.sa_flags = SA_ONSTACK | SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+
+    for (std::size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        sigaction(CRASH_SIGNALS[i], &action, &s_previousActions[i]);
+    }
+#endif
+
+    m_isInstalled = true;
+}
+
+void FlightRecorder::Uninstall() noexcept {
+    if (!m_isInstalled) return;
+
+#if defined(_WIN32)
+    for (std::size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        std::signal(CRASH_SIGNALS[i], s_previousHandlers[i]);
+    }
+#else
+    for (std::size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        sigaction(CRASH_SIGNALS[i], &s_previousActions[i], nullptr);
+    }
+#endif
+
+    s_activeRecorder.store(nullptr);
+    m_isInstalled = false;
+}
+
+void FlightRecorder::Record(const FlightRecord& record) noexcept {
+    // Single writer: fill the slot first, then publish it to the dump path
+    const std::uint64_t count = m_writeCount.load(std::memory_order_relaxed);
+    m_records[static_cast<std::size_t>(count % m_capacity)] = record;
+    m_writeCount.store(count + 1, std::memory_order_release);
+}
+
+std::size_t FlightRecorder::GetRecordCount() const noexcept {
+    return static_cast<std::size_t>(
+        std::min<std::uint64_t>(m_writeCount.load(std::memory_order_acquire), m_capacity));
+}
+
+void FlightRecorder::DumpException(const char* message) noexcept {
+    if (!m_isInstalled) return;
+
+    if (WriteDump(0, message)) {
+        std::cerr << "Flight recorder written to " << m_dumpPath.data() << std::endl;
+    }
+}
+
+bool FlightRecorder::WriteDump(std::int32_t reason, const char* message) const noexcept {
+    const std::uint64_t writeCount = m_writeCount.load(std::memory_order_acquire);
+    const std::size_t recordCount = static_cast<std::size_t>(std::min<std::uint64_t>(writeCount, m_capacity));
+    const std::size_t oldest = static_cast<std::size_t>((writeCount - recordCount) % m_capacity);
+
+    FlightDumpHeader header;
+    FillMagic(header.magic);
+    header.version = DUMP_VERSION;
+    header.recordSize = static_cast<std::uint32_t>(sizeof(FlightRecord));
+    header.recordCount = static_cast<std::uint32_t>(recordCount);
+    header.reason = reason;
+    CopyString(header.message.data(), header.message.size(), message);
+
+    const int fd = OpenDumpFile(m_dumpPath.data());
+    if (fd < 0) return false;
+
+    // Oldest records first: [oldest, end) then [0, oldest) once the ring has wrapped
+    const std::size_t firstSpan = std::min(recordCount, m_capacity - oldest);
+    bool success = WriteAll(fd, &header, sizeof(header));
+    success = success && WriteAll(fd, &m_records[oldest], firstSpan * sizeof(FlightRecord));
+    success = success && WriteAll(fd, &m_records[0], (recordCount - firstSpan) * sizeof(FlightRecord));
+
+    CloseDumpFile(fd);
+    return success;
+}
+
+void FlightRecorder::HandleSignal(int signal) {
+    if (s_isDumping == 0) {
+        s_isDumping = 1;
+
+        if (const FlightRecorder* recorder = s_activeRecorder.load(); recorder != nullptr) {
+            const char* reason = (signal == SIGSEGV) ? "SIGSEGV" :
+                                 (signal == SIGABRT) ? "SIGABRT" :
+                                 (signal == SIGFPE)  ? "SIGFPE"  : "SIGILL";
+            if (recorder->WriteDump(signal, reason)) {
+                WriteStderr("Flight recorder written to ");
+                WriteStderr(recorder->m_dumpPath.data());
+                WriteStderr("\n");
+            }
+        }
+    }
+
+    // Let the default action (core dump / termination) happen
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+bool FlightRecorder::LoadDump(const std::string& path, FlightDumpHeader& header,
+                              std::vector<FlightRecord>& records) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open flight recorder dump: " << path << std::endl;
+        return false;
+    }
+
+    std::array<char, 8> expectedMagic{};
+    FillMagic(expectedMagic);
+
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != expectedMagic || header.version != DUMP_VERSION ||
+        header.recordSize != sizeof(FlightRecord)) {
+        std::cerr << "Not a compatible flight recorder dump: " << path << std::endl;
+        return false;
+    }
+
+    records.resize(header.recordCount);
+    if (!file.read(reinterpret_cast<char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(FlightRecord)))) {
+        std::cerr << "Flight recorder dump is truncated: " << path << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,370 @@
+#include "FrameCapture.hpp"
+#include "ThreadTuning.hpp"
+#include "rlgl.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+// The vendored raylib exposes its glad loader and msf_gif implementation;
+// a system raylib may not ship these headers.
+#if __has_include("external/glad.h")
+    #include "external/glad.h"
+    #define PLAYASGOBO_HAS_GL_READBACK 1
+#endif
+#if __has_include("external/msf_gif.h")
+    #include "external/msf_gif.h"
+    #define PLAYASGOBO_HAS_GIF_ENCODER 1
+#endif
+
+namespace PlayAsGobo {
+
+namespace {
+
+std::size_t WriteToFile(const void* buffer, std::size_t size, std::size_t count, void* stream) {
+    return std::fwrite(buffer, size, count, static_cast<std::FILE*>(stream));
+}
+
+} // namespace
+
+FrameCapture::~FrameCapture() {
+    Stop();
+}
+
+void FrameCapture::ValidateDownscale(std::int32_t downscale) const {
+    if (downscale < MIN_DOWNSCALE || downscale > MAX_DOWNSCALE) {
+        throw std::invalid_argument("Capture downscale must be between " +
+                                  std::to_string(MIN_DOWNSCALE) + " and " +
+                                  std::to_string(MAX_DOWNSCALE));
+    }
+}
+
+bool FrameCapture::Start(const std::string& outputPath, CaptureFormat format, std::int32_t downscale) {
+    ValidateDownscale(downscale);
+
+    if (m_isRecording) {
+        Stop();
+    }
+
+    if (!IsWindowReady()) {
+        std::cerr << "Warning: Cannot start capture without a window" << std::endl;
+        return false;
+    }
+
+#if !defined(PLAYASGOBO_HAS_GIF_ENCODER)
+    if (format == CaptureFormat::Gif) {
+        std::cerr << "Warning: GIF capture requires the vendored raylib (msf_gif)" << std::endl;
+        return false;
+    }
+#endif
+
+    m_outputPath = outputPath;
+    m_format = format;
+    m_downscale = downscale;
+    m_sourceWidth = GetRenderWidth();
+    m_sourceHeight = GetRenderHeight();
+    m_frameWidth = m_sourceWidth / downscale;
+    m_frameHeight = m_sourceHeight / downscale;
+
+    if (m_frameWidth <= 0 || m_frameHeight <= 0) {
+        std::cerr << "Warning: Capture frame size is empty, not recording" << std::endl;
+        return false;
+    }
+
+    // All frame memory is allocated here, never while recording
+    const std::size_t frameBytes = static_cast<std::size_t>(m_frameWidth) * m_frameHeight * 4;
+    m_freeFrames.clear();
+    m_readyFrames.clear();
+    for (std::size_t i = 0; i < m_framePool.size(); ++i) {
+        m_framePool[i].pixels.assign(frameBytes, 0);
+        m_framePool[i].duration = 0.0;
+        m_freeFrames.push_back(i);
+    }
+
+    m_minFrameInterval = (format == CaptureFormat::Gif) ? GIF_MIN_FRAME_INTERVAL : 0.0;
+    m_lastCaptureTime = -1.0;
+    m_capturedFrames = 0;
+    m_droppedFrames = 0;
+    m_stopRequested = false;
+
+    m_usePixelBuffers = CreatePixelBuffers();
+    if (!m_usePixelBuffers) {
+        std::cerr << "Warning: Pixel buffers unavailable, capture falls back to synchronous readback" << std::endl;
+    }
+
+    try {
+        m_encoderThread = std::thread(&FrameCapture::RunEncoder, this);
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: Failed to start capture encoder: " << e.what() << std::endl;
+        DestroyPixelBuffers();
+        return false;
+    }
+
+    m_isRecording = true;
+    std::cout << "Recording gameplay to " << m_outputPath << " (" << m_frameWidth << "x"
+              << m_frameHeight << ")" << std::endl;
+    return true;
+}
+
+void FrameCapture::Stop() {
+    if (!m_isRecording) return;
+
+    // Flush the frame that is still in flight on the GPU
+    if (m_usePixelBuffers && IsWindowReady()) {
+        const std::size_t lastWritten = 1 - m_writeBufferIndex;
+        if (m_pixelBufferPending[lastWritten]) {
+            const double duration = std::max(GetTime() - m_lastCaptureTime, m_minFrameInterval);
+            ReadbackPixelBuffer(lastWritten, duration);
+        }
+    }
+    DestroyPixelBuffers();
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopRequested = true;
+    }
+    m_queueCondition.notify_all();
+
+    if (m_encoderThread.joinable()) {
+        m_encoderThread.join();
+    }
+
+    m_isRecording = false;
+    std::cout << "Saved capture " << m_outputPath << " (" << m_capturedFrames << " frames, "
+              << m_droppedFrames << " dropped)" << std::endl;
+}
+
+bool FrameCapture::CreatePixelBuffers() {
+#if defined(PLAYASGOBO_HAS_GL_READBACK)
+    const int version = rlGetVersion();
+    if (version != RL_OPENGL_21 && version != RL_OPENGL_33 && version != RL_OPENGL_43) {
+        return false;
+    }
+    if (glad_glGenBuffers == nullptr || glad_glMapBuffer == nullptr || glad_glUnmapBuffer == nullptr) {
+        return false;
+    }
+
+    const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(m_sourceWidth) * m_sourceHeight * 4;
+
+    glGenBuffers(static_cast<GLsizei>(m_pixelBuffers.size()), m_pixelBuffers.data());
+    for (const unsigned int buffer : m_pixelBuffers) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, bufferSize, nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    m_pixelBufferPending = {false, false};
+    m_writeBufferIndex = 0;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void FrameCapture::DestroyPixelBuffers() noexcept {
+#if defined(PLAYASGOBO_HAS_GL_READBACK)
+    if (m_pixelBuffers[0] != 0 && IsWindowReady()) {
+        glDeleteBuffers(static_cast<GLsizei>(m_pixelBuffers.size()), m_pixelBuffers.data());
+    }
+#endif
+    m_pixelBuffers = {0, 0};
+    m_pixelBufferPending = {false, false};
+    m_usePixelBuffers = false;
+}
+
+void FrameCapture::ReadbackPixelBuffer(std::size_t index, double duration) {
+#if defined(PLAYASGOBO_HAS_GL_READBACK)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelBuffers[index]);
+    if (const void* data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY)) {
+        SubmitFrame(static_cast<const std::uint8_t*>(data), true, duration);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#else
+    (void)duration;
+#endif
+    m_pixelBufferPending[index] = false;
+}
+
+void FrameCapture::CaptureFrame() {
+    if (!m_isRecording) return;
+
+    if (GetRenderWidth() != m_sourceWidth || GetRenderHeight() != m_sourceHeight) {
+        std::cerr << "Warning: Window resized during capture - stopping recording" << std::endl;
+        Stop();
+        return;
+    }
+
+    const double now = GetTime();
+    const bool hasPreviousFrame = (m_lastCaptureTime >= 0.0);
+    if (hasPreviousFrame && now - m_lastCaptureTime < m_minFrameInterval) {
+        return;
+    }
+    const double previousDuration = hasPreviousFrame ? now - m_lastCaptureTime : 0.0;
+    m_lastCaptureTime = now;
+
+    // Make sure everything batched so far has reached the back buffer
+    rlDrawRenderBatchActive();
+
+#if defined(PLAYASGOBO_HAS_GL_READBACK)
+    if (m_usePixelBuffers) {
+        // Start this frame's copy, then consume the previous one, which had a whole frame to finish
+        const std::size_t current = m_writeBufferIndex;
+        const std::size_t previous = 1 - current;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelBuffers[current]);
+        glReadPixels(0, 0, m_sourceWidth, m_sourceHeight, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (m_pixelBufferPending[previous]) {
+            ReadbackPixelBuffer(previous, previousDuration);
+        }
+
+        m_pixelBufferPending[current] = true;
+        m_writeBufferIndex = previous;
+        return;
+    }
+#endif
+
+    // Synchronous fallback; the frame duration is approximated by the previous interval
+    if (unsigned char* pixels = rlReadScreenPixels(m_sourceWidth, m_sourceHeight)) {
+        SubmitFrame(pixels, false, hasPreviousFrame ? previousDuration : m_minFrameInterval);
+        MemFree(pixels);
+    }
+}
+
+void FrameCapture::SubmitFrame(const std::uint8_t* pixels, bool bottomUp, double duration) {
+    std::size_t frameIndex = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        if (m_freeFrames.empty()) {
+            // Encoder is behind; drop rather than stall the game
+            ++m_droppedFrames;
+            return;
+        }
+        frameIndex = m_freeFrames.back();
+        m_freeFrames.pop_back();
+    }
+
+    CapturedFrame& frame = m_framePool[frameIndex];
+    frame.duration = duration;
+
+    // Nearest-neighbour downscale, flipping GL's bottom-up rows and forcing opaque alpha
+    const std::size_t sourcePitch = static_cast<std::size_t>(m_sourceWidth) * 4;
+    const std::size_t framePitch = static_cast<std::size_t>(m_frameWidth) * 4;
+    const std::size_t step = static_cast<std::size_t>(m_downscale) * 4;
+
+    for (std::int32_t y = 0; y < m_frameHeight; ++y) {
+        const std::int32_t sourceY = bottomUp ? (m_sourceHeight - 1 - y * m_downscale) : y * m_downscale;
+        const std::uint8_t* sourceRow = pixels + static_cast<std::size_t>(sourceY) * sourcePitch;
+        std::uint8_t* frameRow = frame.pixels.data() + static_cast<std::size_t>(y) * framePitch;
+
+        for (std::int32_t x = 0; x < m_frameWidth; ++x) {
+            std::memcpy(frameRow + x * 4, sourceRow + x * step, 3);
+            frameRow[x * 4 + 3] = 255;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_readyFrames.push_back(frameIndex);
+    }
+    m_queueCondition.notify_one();
+    ++m_capturedFrames;
+}
+
+void FrameCapture::RunEncoder() {
+    ThreadTuning::ApplyToCurrentThread(ThreadRole::Worker);
+
+    std::FILE* file = nullptr;
+    bool outputReady = false;
+    std::uint32_t frameNumber = 0;
+    double centiSecondRemainder = 0.0;
+
+#if defined(PLAYASGOBO_HAS_GIF_ENCODER)
+    MsfGifState gifState{};
+#endif
+
+    switch (m_format) {
+        case CaptureFormat::Gif:
+#if defined(PLAYASGOBO_HAS_GIF_ENCODER)
+            file = std::fopen(m_outputPath.c_str(), "wb");
+            outputReady = (file != nullptr) &&
+                msf_gif_begin_to_file(&gifState, m_frameWidth, m_frameHeight, WriteToFile, file) != 0;
+#endif
+            break;
+        case CaptureFormat::RawFrames:
+            file = std::fopen(m_outputPath.c_str(), "wb");
+            outputReady = (file != nullptr);
+            break;
+        case CaptureFormat::QoiFrames: {
+            std::error_code error;
+            std::filesystem::create_directories(m_outputPath, error);
+            outputReady = !error;
+            break;
+        }
+    }
+
+    if (!outputReady) {
+        std::cerr << "Warning: Cannot open capture output " << m_outputPath << std::endl;
+    }
+
+    for (;;) {
+        std::size_t frameIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this] { return m_stopRequested || !m_readyFrames.empty(); });
+            if (m_readyFrames.empty()) {
+                break; // Stop requested and queue drained
+            }
+            frameIndex = m_readyFrames.front();
+            m_readyFrames.pop_front();
+        }
+
+        CapturedFrame& frame = m_framePool[frameIndex];
+
+        if (outputReady) {
+            switch (m_format) {
+                case CaptureFormat::Gif: {
+#if defined(PLAYASGOBO_HAS_GIF_ENCODER)
+                    const double centiSeconds = frame.duration * 100.0 + centiSecondRemainder;
+                    const int delay = std::max(1, static_cast<int>(centiSeconds));
+                    centiSecondRemainder = centiSeconds - delay;
+                    msf_gif_frame_to_file(&gifState, frame.pixels.data(), delay,
+                                          GIF_MAX_BIT_DEPTH, m_frameWidth * 4);
+#endif
+                    break;
+                }
+                case CaptureFormat::RawFrames:
+                    std::fwrite(frame.pixels.data(), 1, frame.pixels.size(), file);
+                    break;
+                case CaptureFormat::QoiFrames: {
+                    char fileName[64];
+                    std::snprintf(fileName, sizeof(fileName), "frame_%05u.qoi", frameNumber);
+                    const std::string framePath = (std::filesystem::path(m_outputPath) / fileName).string();
+                    const Image image = {frame.pixels.data(), m_frameWidth, m_frameHeight, 1,
+                                         PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+                    ExportImage(image, framePath.c_str());
+                    break;
+                }
+            }
+            ++frameNumber;
+        }
+
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_freeFrames.push_back(frameIndex);
+    }
+
+#if defined(PLAYASGOBO_HAS_GIF_ENCODER)
+    if (m_format == CaptureFormat::Gif && outputReady) {
+        msf_gif_end_to_file(&gifState);
+    }
+#endif
+    if (file) {
+        std::fclose(file);
+    }
+}
+
+} // namespace PlayAsGobo
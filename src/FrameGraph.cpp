@@ -0,0 +1,207 @@
+#include "FrameGraph.hpp"
+#include "ThreadTuning.hpp"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace PlayAsGobo {
+
+FrameGraph::~FrameGraph() {
+    Stop();
+}
+
+void FrameGraph::Start(std::size_t workerCount) {
+    Stop();
+
+    m_isStopping = false;
+    m_workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&FrameGraph::RunWorker, this);
+    }
+}
+
+void FrameGraph::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_taskReady.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+FrameGraph::TaskIndex FrameGraph::AddTask(std::string name, FrameResourceMask reads, FrameResourceMask writes,
+                                          std::function<void()> work, bool mainThreadOnly) {
+    const TaskIndex index = m_tasks.size();
+    std::size_t dependencyCount = 0;
+
+    // Everything an earlier task writes, or reads where this one writes, has to be finished first
+    for (TaskIndex earlier = 0; earlier < index; ++earlier) {
+        Task& other = m_tasks[earlier];
+        const bool conflicts = (other.writes & (reads | writes)) != 0 || (other.reads & writes) != 0;
+        if (conflicts) {
+            other.dependents.push_back(index);
+            ++dependencyCount;
+        }
+    }
+
+    Task task;
+    task.name = std::move(name);
+    task.reads = reads;
+    task.writes = writes;
+    task.work = std::move(work);
+    task.mainThreadOnly = mainThreadOnly;
+    task.dependencyCount = dependencyCount;
+    m_tasks.push_back(std::move(task));
+    return index;
+}
+
+void FrameGraph::Clear() {
+    m_tasks.clear();
+}
+
+void FrameGraph::Run() {
+    if (m_tasks.empty()) return;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_isCancelled.store(false, std::memory_order_relaxed);
+    m_exception = nullptr;
+    m_runStart = GetSeconds();
+    m_remainingTasks = m_tasks.size();
+    for (TaskIndex index = 0; index < m_tasks.size(); ++index) {
+        Task& task = m_tasks[index];
+        task.pendingDependencies = task.dependencyCount;
+        task.startTime = 0.0;
+        task.endTime = 0.0;
+        task.wasRun = false;
+        if (task.dependencyCount == 0) {
+            (task.mainThreadOnly ? m_readyMainTasks : m_readyTasks).push_back(index);
+        }
+    }
+    m_taskReady.notify_all();
+
+    // The caller takes main-thread tasks first, then helps with the rest
+    while (m_remainingTasks > 0) {
+        std::deque<TaskIndex>* queue = !m_readyMainTasks.empty() ? &m_readyMainTasks
+                                     : !m_readyTasks.empty()     ? &m_readyTasks
+                                                                 : nullptr;
+        if (!queue) {
+            m_taskReady.wait(lock);
+            continue;
+        }
+
+        const TaskIndex task = queue->front();
+        queue->pop_front();
+        lock.unlock();
+        std::exception_ptr exception = Execute(task);
+        lock.lock();
+        Complete(task, std::move(exception));
+    }
+
+    m_wallSeconds = GetSeconds() - m_runStart;
+    std::exception_ptr exception = std::exchange(m_exception, nullptr);
+    lock.unlock();
+
+    FindCriticalPath();
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void FrameGraph::RunWorker() {
+    ThreadTuning::ApplyToCurrentThread(ThreadRole::Worker);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_taskReady.wait(lock, [this] { return m_isStopping || !m_readyTasks.empty(); });
+        if (m_isStopping) return;
+
+        const TaskIndex task = m_readyTasks.front();
+        m_readyTasks.pop_front();
+        lock.unlock();
+        std::exception_ptr exception = Execute(task);
+        lock.lock();
+        Complete(task, std::move(exception));
+    }
+}
+
+std::exception_ptr FrameGraph::Execute(TaskIndex index) noexcept {
+    Task& task = m_tasks[index];
+    task.startTime = GetSeconds() - m_runStart;
+    std::exception_ptr exception;
+
+    // Skipped tasks still complete, so their dependents are released (and skipped too)
+    if (!m_isCancelled.load(std::memory_order_relaxed)) {
+        try {
+            task.work();
+        } catch (...) {
+            exception = std::current_exception();
+            Cancel();
+        }
+        task.wasRun = true;
+    }
+
+    task.endTime = task.wasRun ? GetSeconds() - m_runStart : task.startTime;
+    return exception;
+}
+
+void FrameGraph::Complete(TaskIndex index, std::exception_ptr exception) {
+    if (exception && !m_exception) {
+        m_exception = std::move(exception);
+    }
+
+    bool released = false;
+    for (const TaskIndex dependent : m_tasks[index].dependents) {
+        Task& task = m_tasks[dependent];
+        if (--task.pendingDependencies == 0) {
+            (task.mainThreadOnly ? m_readyMainTasks : m_readyTasks).push_back(dependent);
+            released = true;
+        }
+    }
+
+    // The caller waits on the same condition for main-thread tasks and for the end of the run
+    --m_remainingTasks;
+    if (released || m_remainingTasks == 0) {
+        m_taskReady.notify_all();
+    }
+}
+
+void FrameGraph::FindCriticalPath() {
+    // Tasks only depend on earlier ones, so one forward pass finds the longest chain
+    std::vector<double> chainSeconds(m_tasks.size(), 0.0);
+    std::vector<TaskIndex> predecessor(m_tasks.size(), m_tasks.size());
+    m_workSeconds = 0.0;
+
+    for (TaskIndex index = 0; index < m_tasks.size(); ++index) {
+        Task& task = m_tasks[index];
+        task.isOnCriticalPath = false;
+        const double seconds = task.endTime - task.startTime;
+        chainSeconds[index] += seconds;
+        m_workSeconds += seconds;
+
+        for (const TaskIndex dependent : task.dependents) {
+            if (chainSeconds[index] > chainSeconds[dependent]) {
+                chainSeconds[dependent] = chainSeconds[index];
+                predecessor[dependent] = index;
+            }
+        }
+    }
+
+    // Walk the longest chain back from its last task
+    const auto last = std::max_element(chainSeconds.begin(), chainSeconds.end());
+    m_criticalPathSeconds = *last;
+    for (TaskIndex index = static_cast<TaskIndex>(last - chainSeconds.begin()); index < m_tasks.size();
+         index = predecessor[index]) {
+        m_tasks[index].isOnCriticalPath = true;
+    }
+}
+
+double FrameGraph::GetSeconds() noexcept {
+    using Seconds = std::chrono::duration<double>;
+    return Seconds(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace PlayAsGobo
@@ -1,9 +1,54 @@
 #include "Game.hpp"
+#include "QuadWriter.hpp"
+#include "rlgl.h"
+#include <atomic>
 #include <cassert>
+#include <ctime>
+#include <filesystem>
+#include <future>
+#include <iomanip>
 #include <stdexcept>
+#include <utility>
 
 namespace PlayAsGobo {
 
+namespace {
+
+// Attached to the audio mixer so the first callback tunes the audio thread
+// from inside it; raylib gives no other handle on that thread
+std::atomic<bool> s_audioThreadTuned{false};
+
+void TuneAudioThread([[maybe_unused]] void* buffer, [[maybe_unused]] unsigned int frames) {
+    if (!s_audioThreadTuned.exchange(true, std::memory_order_relaxed)) {
+        ThreadTuning::ApplyToCurrentThread(ThreadRole::Audio);
+    }
+}
+
+// Alpha-weighted mean of a sprite's pixels, which is what it reads as from far away
+Color GetAverageColor(const Image& image) {
+    Color* pixels = LoadImageColors(image);
+    if (pixels == nullptr) return WHITE;
+
+    float red = 0.0f;
+    float green = 0.0f;
+    float blue = 0.0f;
+    float weight = 0.0f;
+    for (int i = 0; i < image.width * image.height; ++i) {
+        const float alpha = pixels[i].a / 255.0f;
+        red += pixels[i].r * alpha;
+        green += pixels[i].g * alpha;
+        blue += pixels[i].b * alpha;
+        weight += alpha;
+    }
+    UnloadImageColors(pixels);
+
+    if (weight <= 0.0f) return WHITE;
+    return {static_cast<unsigned char>(red / weight), static_cast<unsigned char>(green / weight),
+            static_cast<unsigned char>(blue / weight), 255};
+}
+
+} // namespace
+
 // Static color array definition
 const std::array<Color, Game::COLOR_COUNT> Game::COLOR_OPTIONS = {{
     {0, 169, 212, 255}, BLACK, WHITE, GREEN, BLUE, YELLOW, ORANGE, PURPLE, BROWN,
@@ -18,6 +63,21 @@ Game::Game()
     , m_mapHeight(0) {
     
     try {
+        ThreadTuning::ApplyToCurrentThread(ThreadRole::Game);
+        
+        // Opening the audio device and decoding files don't need the GL context,
+        // so both run on helper threads while the window comes up. The futures
+        // join on every exit from this block, before the catch below cleans up.
+        DecodedAssets decoded;
+        std::future<void> decoding = std::async(std::launch::async, [&decoded] {
+            ThreadTuning::ApplyToCurrentThread(ThreadRole::Worker);
+            DecodeAssets(decoded);
+        });
+        std::future<bool> audioDevice = std::async(std::launch::async, [] {
+            InitAudioDevice();
+            return IsAudioDeviceReady();
+        });
+        
         // Configure window before creation
         SetConfigFlags(FLAG_WINDOW_RESIZABLE);
         InitWindow(m_currentWindowWidth, m_currentWindowHeight, "Play as Gobo!");
@@ -26,12 +86,6 @@ Game::Game()
             throw std::runtime_error("Failed to initialize window");
         }
 
-        InitAudioDevice();
-        if (!IsAudioDeviceReady()) {
-            CloseWindow();
-            throw std::runtime_error("Failed to initialize audio device");
-        }
-
         SetExitKey(KEY_NULL);
 
         // Update actual window dimensions
@@ -40,27 +94,51 @@ Game::Game()
         m_mapWidth = static_cast<int>(m_currentWindowWidth * 1.5f);
         m_mapHeight = static_cast<int>(m_currentWindowHeight * 1.5f);
 
-        // Set window icon
-        if (Image icon = LoadImage("assets/img/Gobo/Gobo0.png"); icon.data != nullptr) {
-            SetWindowIcon(icon);
-            UnloadImage(icon);
-        }
-
         // Initialize camera
         m_camera.offset = {m_currentWindowWidth / 2.0f, m_currentWindowHeight / 2.0f};
         m_camera.rotation = 0.0f;
         m_camera.zoom = 1.0f;
+        m_renderCamera = m_camera;
+
+        // Join the helpers; sounds can only be created once the device is open
+        decoding.get();
+        if (!audioDevice.get()) {
+            CloseWindow();
+            throw std::runtime_error("Failed to initialize audio device");
+        }
+        if (ThreadTuning::IsRequested(ThreadRole::Audio)) {
+            AttachAudioMixedProcessor(TuneAudioThread);
+        }
 
-        // Load game assets
-        if (!LoadAssets()) {
+        // Set window icon
+        if (decoded.iconImage.data != nullptr) {
+            SetWindowIcon(decoded.iconImage);
+        }
+
+        // Upload game assets
+        if (!LoadAssets(decoded)) {
             throw std::runtime_error("Failed to load game assets");
         }
 
-        // Setup background music
-        PlayMusicStream(m_backgroundMusic);
+        // Setup background music; from here on every audio call goes through the audio thread
         m_backgroundMusic.looping = true;
+        AudioCommands::Start();
+        AudioCommands::PlayMusic(m_backgroundMusic);
 
         SetTargetFPS(60);
+        m_sessionStartTime = GetTime();
+        InstallFlightRecorder();
+        
+        // Music is playing by now, so the audio callback has normally run
+        if (ThreadTuning::IsRequested(ThreadRole::Audio) &&
+            !ThreadTuning::WaitUntilApplied(ThreadRole::Audio, AUDIO_TUNING_TIMEOUT)) {
+            std::cerr << "Warning: Audio thread has not run yet, its tuning will apply when it does" << std::endl;
+        }
+        ThreadTuning::WriteReport(std::cout);
+        BuildFrameGraph();
+        
+        // Best runs from earlier sessions; no file just means no ghosts yet
+        (void)m_ghostLibrary.Load(GHOST_LIBRARY_PATH);
         m_isInitialized = true;
         
     } catch (const std::exception& e) {
@@ -68,6 +146,7 @@ Game::Game()
         UnloadAssets();
         
         if (IsAudioDeviceReady()) {
+            DetachAudioMixedProcessor(TuneAudioThread);
             CloseAudioDevice();
         }
         if (IsWindowReady()) {
@@ -79,9 +158,18 @@ Game::Game()
 }
 
 Game::~Game() {
+    // Finish any recording while the GL context still exists
+    m_frameCapture.Stop();
+    m_gpuTimer.Stop();
+    
+    if (m_isInitialized) {
+        WriteFrameTimingSummary();
+    }
+    
     UnloadAssets();
     
     if (IsAudioDeviceReady()) {
+        DetachAudioMixedProcessor(TuneAudioThread);
         CloseAudioDevice();
     }
     if (IsWindowReady()) {
@@ -89,20 +177,53 @@ Game::~Game() {
     }
 }
 
-bool Game::LoadAssets() {
-    auto loadTextureChecked = [](const char* path) -> std::optional<Texture2D> {
-        if (Texture2D texture = LoadTexture(path); texture.id != 0) {
-            return texture;
-        }
-        std::cerr << "Failed to load texture: " << path << std::endl;
-        return std::nullopt;
+Game::DecodedAssets::~DecodedAssets() {
+    for (Image& image : playerImages) UnloadImage(image);
+    for (Image& image : enemyImages) UnloadImage(image);
+    UnloadImage(groundImage);
+    UnloadImage(finishLineImage);
+    UnloadImage(iconImage);
+    for (Wave& wave : soundWaves) UnloadWave(wave);
+}
+
+void Game::DecodeAssets(DecodedAssets& assets) {
+    // File reads and image/audio decoding only: no GL or audio device calls
+    auto decodeImage = [&assets](const char* path, Image& image) {
+        image = LoadImage(path);
+        if (image.data == nullptr) assets.errors.push_back(std::string("Failed to load texture: ") + path);
     };
 
-    auto loadSoundChecked = [](const char* path) -> std::optional<Sound> {
-        if (Sound sound = LoadSound(path); sound.frameCount != 0) {
-            return sound;
+    for (std::size_t i = 0; i < PLAYER_TEXTURE_PATHS.size(); ++i) {
+        decodeImage(PLAYER_TEXTURE_PATHS[i], assets.playerImages[i]);
+    }
+    for (std::size_t i = 0; i < ENEMY_TEXTURE_PATHS.size(); ++i) {
+        decodeImage(ENEMY_TEXTURE_PATHS[i], assets.enemyImages[i]);
+    }
+    decodeImage("assets/img/Ground.png", assets.groundImage);
+    decodeImage("assets/img/FinishLine.png", assets.finishLineImage);
+    assets.iconImage = LoadImage("assets/img/Gobo/Gobo0.png"); // Optional
+
+    for (std::size_t i = 0; i < SOUND_PATHS.size(); ++i) {
+        assets.soundWaves[i] = LoadWave(SOUND_PATHS[i]);
+        if (assets.soundWaves[i].frameCount == 0) {
+            assets.errors.push_back(std::string("Failed to load sound: ") + SOUND_PATHS[i]);
+        }
+    }
+}
+
+bool Game::LoadAssets(DecodedAssets& decoded) {
+    if (!decoded.errors.empty()) {
+        for (const std::string& error : decoded.errors) {
+            std::cerr << error << std::endl;
         }
-        std::cerr << "Failed to load sound: " << path << std::endl;
+        return false;
+    }
+
+    auto uploadTextureChecked = [](const Image& image) -> std::optional<Texture2D> {
+        if (Texture2D texture = LoadTextureFromImage(image); texture.id != 0) {
+            return texture;
+        }
+        std::cerr << "Failed to upload texture" << std::endl;
         return std::nullopt;
     };
 
@@ -114,63 +235,63 @@ bool Game::LoadAssets() {
         return std::nullopt;
     };
 
-    // Load player textures
-    const std::array<const char*, 3> playerPaths = {
-        "assets/img/Gobo/Gobo0.png",
-        "assets/img/Gobo/Gobo1.png", 
-        "assets/img/Gobo/Gobo2.png"
-    };
-    
-    m_playerTextures.reserve(playerPaths.size());
-    for (const char* path : playerPaths) {
-        if (auto texture = loadTextureChecked(path)) {
+    // Upload player textures
+    m_playerTextures.reserve(decoded.playerImages.size());
+    for (const Image& image : decoded.playerImages) {
+        if (auto texture = uploadTextureChecked(image)) {
             m_playerTextures.push_back(*texture);
         } else {
             return false;
         }
     }
 
-    // Load enemy textures
-    const std::array<const char*, 4> enemyPaths = {
-        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother0.png",
-        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother1.png",
-        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother2.png",
-        "assets/img/Juicy Boy's Brother/Juicy Boy's Brother3.png"
-    };
-    
-    m_enemyTextures.reserve(enemyPaths.size());
-    for (const char* path : enemyPaths) {
-        if (auto texture = loadTextureChecked(path)) {
+    // Upload enemy textures
+    m_enemyTextures.reserve(decoded.enemyImages.size());
+    for (const Image& image : decoded.enemyImages) {
+        if (auto texture = uploadTextureChecked(image)) {
             m_enemyTextures.push_back(*texture);
         } else {
             return false;
         }
     }
 
-    // Load other textures
-    if (auto groundTexture = loadTextureChecked("assets/img/Ground.png")) {
+    // Upload other textures
+    if (auto groundTexture = uploadTextureChecked(decoded.groundImage)) {
         m_groundTexture = *groundTexture;
     } else return false;
 
-    if (auto finishTexture = loadTextureChecked("assets/img/FinishLine.png")) {
+    // Kept on the CPU so the destructible terrain can be re-tiled on restart and resize
+    m_groundImage = std::exchange(decoded.groundImage, Image{});
+
+    if (auto finishTexture = uploadTextureChecked(decoded.finishLineImage)) {
         m_finishLineTexture = *finishTexture;
     } else return false;
 
-    // Load sounds
-    const std::array<std::pair<const char*, Sound*>, 7> soundPaths = {{
-        {"assets/audio/explosion.wav", &m_explosionSound},
-        {"assets/audio/LoseSound.wav", &m_loseSound},
-        {"assets/audio/HoverOnButtonSound.wav", &m_hoverButtonSound},
-        {"assets/audio/OpenButtonSound.wav", &m_openButtonSound},
-        {"assets/audio/BackButtonSound.wav", &m_backButtonSound},
-        {"assets/audio/NO!.wav", &m_exitNoSound},
-        {"assets/audio/Disappointing.wav", &m_exitDisappointingSound}
-    }};
+    m_projectiles.LoadSprite();
+    LoadBehaviourScripts();
 
-    for (const auto& [path, soundPtr] : soundPaths) {
-        if (auto sound = loadSoundChecked(path)) {
-            *soundPtr = *sound;
-        } else {
+    // Zoomed-out stand-ins: one glow per explosion, one flat colour per sprite
+    if (Image glowImage = GenImageGradientRadial(GLOW_SPRITE_SIZE, GLOW_SPRITE_SIZE, 0.0f, WHITE, BLANK);
+        glowImage.data != nullptr) {
+        m_glowTexture = LoadTextureFromImage(glowImage);
+        UnloadImage(glowImage);
+    }
+    if (!m_lightBuffer.Resize(m_currentWindowWidth, m_currentWindowHeight)) {
+        std::cerr << "Warning: Failed to create the light buffer, glow is disabled" << std::endl;
+    }
+    m_playerImpostorColor = GetAverageColor(decoded.playerImages.front());
+    m_enemyImpostorColor = GetAverageColor(decoded.enemyImages.front());
+
+    // Create sounds from the decoded waves, in SOUND_PATHS order
+    const std::array<Sound*, SOUND_PATHS.size()> sounds = {
+        &m_explosionSound, &m_loseSound, &m_hoverButtonSound, &m_openButtonSound,
+        &m_backButtonSound, &m_exitNoSound, &m_exitDisappointingSound
+    };
+
+    for (std::size_t i = 0; i < sounds.size(); ++i) {
+        *sounds[i] = LoadSoundFromWave(decoded.soundWaves[i]);
+        if (sounds[i]->frameCount == 0) {
+            std::cerr << "Failed to load sound: " << SOUND_PATHS[i] << std::endl;
             return false;
         }
     }
@@ -192,7 +313,20 @@ bool Game::LoadAssets() {
     return true;
 }
 
+void Game::LoadBehaviourScripts() {
+    // A missing or broken script leaves that archetype on its built-in kernel
+    for (std::size_t i = 0; i < ENEMY_ARCHETYPE_COUNT; ++i) {
+        std::string error;
+        if (!m_behaviourPrograms[i].LoadFromFile(BEHAVIOUR_SCRIPT_PATHS[i], error)) {
+            std::cerr << "Warning: " << error << ", using the built-in behaviour" << std::endl;
+        }
+    }
+}
+
 void Game::UnloadAssets() noexcept {
+    // The audio thread may still be using the sounds
+    AudioCommands::Stop();
+    
     // Unload textures
     for (auto& texture : m_playerTextures) {
         if (texture.id != 0) UnloadTexture(texture);
@@ -205,7 +339,19 @@ void Game::UnloadAssets() noexcept {
     m_enemyTextures.clear();
 
     if (m_groundTexture.id != 0) UnloadTexture(m_groundTexture);
+    if (m_groundImage.data != nullptr) UnloadImage(m_groundImage);
+    m_groundImage = Image{};
+    m_terrain.Unload();
+    m_groundMesh.Unload();
+    m_finishLineMesh.Unload();
     if (m_finishLineTexture.id != 0) UnloadTexture(m_finishLineTexture);
+    m_projectiles.UnloadSprite();
+    if (m_glowTexture.id != 0) UnloadTexture(m_glowTexture);
+    m_glowTexture = Texture2D{};
+    if (m_frozenFrame.id != 0) UnloadRenderTexture(m_frozenFrame);
+    m_frozenFrame = RenderTexture2D{};
+    m_isFrozenFrameValid = false;
+    m_lightBuffer.Unload();
 
     // Unload sounds
     if (m_explosionSound.frameCount != 0) UnloadSound(m_explosionSound);
@@ -230,14 +376,209 @@ void Game::CreateGrounds() {
     const float mainGroundY = m_currentWindowHeight - groundHeight;
     const float groundX = (m_currentWindowWidth - m_mapWidth) / 2.0f;
     
-    auto mainGround = std::make_unique<Ground>(
+    Ground* mainGround = m_sessionArena.Create<Ground>(
         groundX, mainGroundY, static_cast<float>(m_mapWidth), 
         groundHeight, m_groundTexture
     );
     
-    if (mainGround) {
-        m_grounds.push_back(std::move(mainGround));
+    m_grounds.push_back(mainGround);
+    
+    // Platforms get their real paths from LayoutPlatforms; only crushers are solid from below
+    for (const PlatformLayout& layout : PLATFORM_LAYOUTS) {
+        const bool isCrusher = (layout.motion == PlatformMotion::Crusher);
+        Ground* platform = m_sessionArena.Create<Ground>(
+            0.0f, 0.0f, layout.width * m_mapWidth, layout.height,
+            m_groundTexture, isCrusher ? CRUSHER_TINT : WHITE
+        );
+        platform->SetOneWay(!isCrusher);
+        m_platforms.Add(platform, PlatformPath{});
+    }
+}
+
+void Game::LayoutWorld() {
+    if (m_grounds.empty()) {
+        return;
+    }
+    
+    const float groundHeight = GetGroundHeight();
+    const float groundY = m_currentWindowHeight - groundHeight;
+    const float groundX = (m_currentWindowWidth - m_mapWidth) / 2.0f;
+    
+    m_grounds[0]->SetBounds({groundX, groundY, static_cast<float>(m_mapWidth), groundHeight});
+    
+    if (m_finishLine) {
+        const Vector2 finishLineSize = GetFinishLineSize();
+        const float finishLineX = (m_currentWindowWidth / 2.0f) - (finishLineSize.x / 2.0f);
+        const float finishLineY = groundY - finishLineSize.y;
+        
+        m_finishLine->SetPosition(finishLineX, finishLineY);
+    }
+    
+    LayoutPlatforms();
+    RebuildTerrain();
+    RebuildLevelMeshes();
+    RebuildGroundGrid();
+}
+
+void Game::LayoutPlatforms() {
+    const Rectangle ground = m_grounds[0]->GetBounds();
+    const float windowHeight = static_cast<float>(m_currentWindowHeight);
+    
+    for (std::size_t i = 0; i < m_platforms.GetCount() && i < PLATFORM_LAYOUTS.size(); ++i) {
+        const PlatformLayout& layout = PLATFORM_LAYOUTS[i];
+        PlatformPath path;
+        path.motion = layout.motion;
+        path.from = {ground.x + layout.fromX * ground.width, ground.y - layout.fromY * windowHeight - layout.height};
+        path.to = {ground.x + layout.toX * ground.width, ground.y - layout.toY * windowHeight - layout.height};
+        path.period = layout.period;
+        path.phase = layout.phase;
+        m_platforms.SetPath(i, path);
+    }
+}
+
+void Game::RebuildGroundGrid() {
+    // Covers the map and the sky above it; anything further out shares the edge cells
+    const Rectangle ground = m_grounds[0]->GetBounds();
+    m_groundGrid.Reset({ground.x, ground.y - m_mapHeight, ground.width, m_mapHeight + ground.height});
+    for (Ground* level : m_grounds) {
+        m_groundGrid.Insert(level);
+    }
+    m_platforms.Register(m_groundGrid);
+}
+
+void Game::CarryEntities() {
+    // Whatever stood on a platform last tick moves with it
+    const auto carry = [](Entity* entity) {
+        if (entity && entity->IsOnGround() && entity->GetSupport()) {
+            entity->Move(entity->GetSupport()->GetDisplacement());
+        }
+    };
+    
+    carry(m_player);
+    for (Enemy* enemy : m_enemies) {
+        carry(enemy);
+    }
+}
+
+const Ground* Game::FindCrushingPlatform(const Entity* entity) const {
+    if (!entity || entity->CanPhase()) return nullptr;
+    
+    // A solid platform on its way down whose underside has reached something still below its top
+    const Circle& bounds = entity->GetBounds();
+    const Rectangle area = {bounds.center.x - bounds.radius, bounds.center.y - bounds.radius,
+                            bounds.radius * 2.0f, bounds.radius * 2.0f};
+    const Ground* crusher = nullptr;
+    m_groundGrid.Query(area, [&](const Ground* ground) {
+        if (ground->IsOneWay() || ground->GetDisplacement().y <= 0.0f) return false;
+        if (ground->GetY() > bounds.center.y || !ground->CheckCollision(bounds)) return false;
+        crusher = ground;
+        return true;
+    });
+    return crusher;
+}
+
+void Game::HandlePlayerCrush() {
+    const Ground* crusher = FindCrushingPlatform(m_player);
+    if (!crusher) return;
+    
+    // Squeezed out to whichever side is nearer
+    m_player->TakeDamage();
+    const float radius = m_player->GetRadius();
+    if (m_player->GetX() < crusher->GetCenter().x) {
+        m_player->SetX(crusher->GetX() - radius);
+    } else {
+        m_player->SetX(crusher->GetX() + crusher->GetWidth() + radius);
+    }
+}
+
+void Game::RebuildTerrain() {
+    if (m_grounds.empty() || !m_grounds[0]) {
+        return;
+    }
+    
+    // Craters do not survive a restart or a resize; the mask is re-tiled to the new bounds
+    m_terrain.Rebuild(m_grounds[0]->GetBounds(), m_groundImage);
+    m_grounds[0]->SetTerrainMask(&m_terrain);
+    m_terrainHasher = StateHasher{};
+}
+
+void Game::RebuildLevelMeshes() {
+    // Level tiles only move on restart and resize, so they are baked once per layout
+    std::vector<StaticTile> tiles;
+    for (const Ground* ground : m_grounds) {
+        if (ground && !ground->HasReadyTerrain()) {
+            ground->CollectTiles(tiles);
+        }
+    }
+    if (tiles.empty() || !m_groundMesh.Build(m_groundTexture, tiles)) {
+        m_groundMesh.Unload();
+    }
+    
+    tiles.clear();
+    if (m_finishLine) {
+        m_finishLine->CollectTiles(tiles);
+    }
+    if (tiles.empty() || !m_finishLineMesh.Build(m_finishLine->GetTexture(), tiles)) {
+        m_finishLineMesh.Unload();
+    }
+}
+
+Rectangle Game::GetVisibleWorldArea() const noexcept {
+    const Vector2 topLeft = GetScreenToWorld2D({0.0f, 0.0f}, m_renderCamera);
+    const Vector2 bottomRight = GetScreenToWorld2D(
+        {static_cast<float>(m_currentWindowWidth), static_cast<float>(m_currentWindowHeight)}, m_renderCamera);
+    return {topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y};
+}
+
+Camera2D Game::GetOverviewCamera() const noexcept {
+    // Frames every ground across and the full map height up from the window bottom
+    Camera2D overview = m_camera;
+    if (m_grounds.empty()) return overview;
+
+    float left = m_grounds.front()->GetX();
+    float right = left + m_grounds.front()->GetWidth();
+    for (const Ground* ground : m_grounds) {
+        left = std::min(left, ground->GetX());
+        right = std::max(right, ground->GetX() + ground->GetWidth());
+    }
+    const float bottom = static_cast<float>(m_currentWindowHeight);
+    const float top = bottom - static_cast<float>(m_mapHeight);
+    if (right <= left || bottom <= top) return overview;
+
+    overview.target = {(left + right) / 2.0f, (top + bottom) / 2.0f};
+    overview.zoom = std::min({m_currentWindowWidth / (right - left), m_currentWindowHeight / (bottom - top),
+                              m_camera.zoom});
+    return overview;
+}
+
+void Game::UpdateRenderCamera(float frameSeconds) {
+    // Eased in wall-clock time; the simulation camera is left alone so toggling
+    // the overview can't change spawning or the state hash
+    const float goal = m_overviewEnabled ? 1.0f : 0.0f;
+    m_overviewBlend = Lerp(m_overviewBlend, goal, Clamp(frameSeconds * OVERVIEW_BLEND_RATE, 0.0f, 1.0f));
+    if (FloatEquals(m_overviewBlend, goal)) m_overviewBlend = goal;
+
+    const Camera2D overview = GetOverviewCamera();
+    m_renderCamera = m_camera;
+    m_renderCamera.target = Vector2Lerp(m_camera.target, overview.target, m_overviewBlend);
+    m_renderCamera.zoom = Lerp(m_camera.zoom, overview.zoom, m_overviewBlend);
+}
+
+void Game::CarveExplosionCraters() {
+    for (const ExplosionImpact& impact : m_explosionManager.GetPendingImpacts()) {
+        // Bombs go off above the ground, so the crater is centred where the blast meets the surface
+        const float reach = impact.position.y + impact.radius * CRATER_REACH_SCALE;
+        const std::optional<float> surfaceY = m_terrain.FindSurfaceBelow(impact.position.x, impact.position.y, reach);
+        
+        if (surfaceY) {
+            m_terrain.Carve({impact.position.x, *surfaceY}, impact.radius * CRATER_RADIUS_SCALE);
+            m_terrainHasher.Add(impact.position.x);
+            m_terrainHasher.Add(*surfaceY);
+            m_terrainHasher.Add(impact.radius);
+        }
     }
+    
+    m_explosionManager.ClearPendingImpacts();
 }
 
 float Game::GetGroundHeight() const noexcept {
@@ -265,12 +606,43 @@ Vector2 Game::GetInputPosition() const {
     return {-1.0f, -1.0f}; // No input detected
 }
 
+Vector2 Game::GetFinishLineSize() const noexcept {
+    if (m_finishLineTexture.id != 0) {
+        return {static_cast<float>(m_finishLineTexture.width * FINISH_LINE_WIDTH),
+                static_cast<float>(m_finishLineTexture.height)};
+    }
+    return {200.0f, 50.0f};
+}
+
+float Game::GetPlayerBaseRadius() const noexcept {
+    return (!m_playerTextures.empty() && m_playerTextures[0].id != 0) ? 
+        static_cast<float>(m_playerTextures[0].width) : TEXTURE_RESOLUTION;
+}
+
+Vector2 Game::GetPlayerSpawnPosition() const noexcept {
+    const float groundY = m_currentWindowHeight - GetGroundHeight();
+    return {m_currentWindowWidth / 2.0f, groundY - GetPlayerBaseRadius() - 50.0f};
+}
+
 void Game::InitializeEntities() {
-    // Clear existing entities
-    m_player.reset();
-    m_enemies.clear();
+    // Release the previous session's objects in one step
+    m_player = nullptr;
+    ClearEnemies();
     m_grounds.clear();
-    m_finishLine.reset();
+    m_platforms.Clear();
+    m_finishLine = nullptr;
+    m_enemyPool.Reset();
+    m_sessionArena.Reset();
+
+    // Size bookkeeping once so spawning never reallocates mid-session
+    m_enemies.reserve(MAX_ENEMIES_LIMIT);
+    for (std::vector<Enemy*>& batch : m_enemiesByArchetype) {
+        batch.reserve(MAX_ENEMIES_LIMIT);
+    }
+    m_enemiesToRemove.reserve(MAX_ENEMIES_LIMIT);
+    m_enemyPool.Reserve(MAX_ENEMIES_LIMIT);
+    m_projectileTargets.reserve(MAX_ENEMIES_LIMIT);
+    m_enemyShotHits.reserve(MAX_ENEMIES_LIMIT);
 
     // Update map dimensions
     m_mapWidth = static_cast<int>(m_currentWindowWidth * 1.5f);
@@ -278,33 +650,40 @@ void Game::InitializeEntities() {
 
     CreateGrounds();
 
-    // Create finish line
-    const float screenCenterX = m_currentWindowWidth / 2.0f;
-    const float finishLineWidth = (m_finishLineTexture.id != 0) ? 
-        m_finishLineTexture.width * FINISH_LINE_WIDTH : 200.0f;
-    const float finishLineHeight = (m_finishLineTexture.id != 0) ? 
-        static_cast<float>(m_finishLineTexture.height) : 50.0f;
-    
-    const float groundY = m_currentWindowHeight - GetGroundHeight();
-    const float finishLineY = groundY - finishLineHeight;
-    const float finishLineX = screenCenterX - finishLineWidth / 2.0f;
-    
-    m_finishLine = std::make_unique<FinishLine>(
-        finishLineX, finishLineY, finishLineWidth, 
-        finishLineHeight, m_finishLineTexture
+    // Create finish line (positioned by LayoutWorld)
+    const Vector2 finishLineSize = GetFinishLineSize();
+    m_finishLine = m_sessionArena.Create<FinishLine>(
+        0.0f, 0.0f, finishLineSize.x, finishLineSize.y, m_finishLineTexture
     );
     
-    // Create player
-    const float playerRadius = (!m_playerTextures.empty() && m_playerTextures[0].id != 0) ? 
-        static_cast<float>(m_playerTextures[0].width) : TEXTURE_RESOLUTION;
-    
-    const float playerStartX = screenCenterX;
-    const float playerStartY = groundY - playerRadius - 50.0f;
+    LayoutWorld();
     
-    m_player = std::make_unique<Player>(
-        playerStartX, playerStartY, playerRadius, 
+    // Create player
+    const Vector2 playerStart = GetPlayerSpawnPosition();
+    m_player = m_sessionArena.Create<Player>(
+        playerStart.x, playerStart.y, GetPlayerBaseRadius(), 
         m_playerTextures, m_playerRunSound, START_TEXTURE_SCALE
     );
+    
+    SeedSession();
+    StartGhostSession();
+}
+
+void Game::SeedSession() {
+    // A replay reuses the seed of the recorded session, the benchmark always uses
+    // the same one and live play draws a fresh one
+    if (m_isReplaying && m_replayCursor < m_replayRecords.size()) {
+        m_sessionSeed = m_replayRecords[m_replayCursor].sessionSeed;
+    } else if (m_benchmark.IsRunning()) {
+        m_sessionSeed = Benchmark::SCENE_SEED;
+    } else {
+        m_sessionSeed = std::random_device{}();
+    }
+    
+    m_randomGenerator.seed(m_sessionSeed);
+    m_randomDrawCount = 0;
+    m_sessionTick = 0;
+    m_sessionStartPending = true;
 }
 
 void Game::SpawnEnemies() {
@@ -317,40 +696,88 @@ void Game::SpawnEnemies() {
         return;
     }
     
-    const float enemyRadius = (!m_enemyTextures.empty() && m_enemyTextures[0].id != 0) ? 
-        m_enemyTextures[0].width * m_enemyScale : TEXTURE_RESOLUTION * m_enemyScale;
-    
-    std::unique_ptr<Enemy> enemy;
+    Enemy* enemy = nullptr;
     const bool spawnFromLeft = (GenerateRandomInt(0, 1) == 0);
+    const EnemyArchetype archetype = PickEnemyArchetype();
+    const EnemyArchetypeParams& params = GetEnemyArchetypeParams(archetype);
+    
+    const float baseRadius = (!m_enemyTextures.empty() && m_enemyTextures[0].id != 0) ? 
+        m_enemyTextures[0].width * m_enemyScale : TEXTURE_RESOLUTION * m_enemyScale;
+    const float enemyRadius = baseRadius * params.radiusScale;
+    const float enemySpeed = 200.0f * params.speedScale;
     
     if (spawnFromLeft) {
-        enemy = std::make_unique<Enemy>(
+        enemy = m_enemyPool.Acquire(
             m_camera.target.x - m_currentWindowWidth/2.0f - 10.0f, 
             static_cast<float>(m_currentWindowHeight) / GenerateRandomInt(2, 4),
             enemyRadius, m_enemyTextures,
-            200.0f, EnemyDirection::Right
+            enemySpeed, EnemyDirection::Right, archetype
         );
     } else {
-        enemy = std::make_unique<Enemy>(
+        enemy = m_enemyPool.Acquire(
             m_camera.target.x + m_currentWindowWidth/2.0f + 10.0f, 
             static_cast<float>(m_currentWindowHeight) / GenerateRandomInt(2, 4),
             enemyRadius, m_enemyTextures,
-            200.0f, EnemyDirection::Left
+            enemySpeed, EnemyDirection::Left, archetype
         );
     }
 
     if (enemy) {
-        m_enemies.push_back(std::move(enemy));
+        enemy->SetSerialNumber(static_cast<std::uint16_t>(m_enemiesSpawned));
+        m_enemies.push_back(enemy);
+        m_enemiesByArchetype[static_cast<std::size_t>(archetype)].push_back(enemy);
     }
 
     m_enemySpawnTimer = 0.0f;
     m_enemySpawnInterval *= 0.75f; // Make spawning faster over time
 }
 
-void Game::ApplyGravity(Entity* entity) {
+EnemyArchetype Game::PickEnemyArchetype() {
+    // Only walkers at first; one more archetype joins the mix every few spawns
+    const int unlockedCount = std::min(static_cast<int>(ENEMY_ARCHETYPE_COUNT),
+                                       1 + static_cast<int>(m_enemiesSpawned / ENEMIES_PER_ARCHETYPE_UNLOCK));
+    ++m_enemiesSpawned;
+    
+    return static_cast<EnemyArchetype>(GenerateRandomInt(0, unlockedCount - 1));
+}
+
+void Game::ClearEnemies() noexcept {
+    m_enemies.clear();
+    for (std::vector<Enemy*>& batch : m_enemiesByArchetype) {
+        batch.clear();
+    }
+}
+
+void Game::UpdateEnemyAI() {
+    if (!m_player || !m_finishLine || m_grounds.empty()) return;
+    
+    EnemyAIContext context;
+    context.deltaTime = m_deltaTime;
+    context.mapWidth = static_cast<float>(m_mapWidth);
+    context.finishLineX = m_finishLine->GetX() + m_finishLine->GetWidth()/2;
+    context.groundY = m_grounds[0]->GetY();
+    context.gravity = GRAVITY;
+    context.player = m_player;
+    context.projectiles = &m_projectiles;
+    
+    // One behaviour per archetype, each over a homogeneous batch: the archetype's
+    // script when it compiled, otherwise its specialised native kernel
+    ForEachEnemyArchetype([this, &context](auto archetype) {
+        const std::size_t index = static_cast<std::size_t>(archetype.value);
+        const std::vector<Enemy*>& batch = m_enemiesByArchetype[index];
+        if (m_behaviourPrograms[index].IsValid()) {
+            Enemy::ExecuteScriptedAIBatch(batch.data(), batch.size(), m_behaviourPrograms[index],
+                                          m_behaviourVM, context);
+        } else {
+            Enemy::ExecuteAIBatch<decltype(archetype)::value>(batch.data(), batch.size(), context);
+        }
+    });
+}
+
+void Game::ApplyGravity(Entity* entity, float gravityScale) {
     if (!entity) return;
     
-    entity->SetVelocityY(entity->GetVelocityY() + GRAVITY * m_deltaTime);
+    entity->SetVelocityY(entity->GetVelocityY() + GRAVITY * gravityScale * m_deltaTime);
     entity->SetY((entity->GetY() - entity->GetRadius() + 
                  entity->GetVelocityY() * m_deltaTime) + entity->GetRadius());
 }
@@ -360,14 +787,34 @@ CollisionInfo Game::GetGroundCollisionInfo(Entity* entity) const {
     if (!entity) return info;
     
     const Circle entityBounds = entity->GetBounds();
+    const Rectangle area = {entityBounds.center.x - entityBounds.radius, entityBounds.center.y - entityBounds.radius,
+                            entityBounds.radius * 2.0f, entityBounds.radius * 2.0f};
 
-    for (const auto& ground : m_grounds) {
+    m_groundGrid.Query(area, [&](Ground* ground) {
         if (!ground || !ground->CheckCollision(entityBounds)) {
-            continue;
+            return false;
+        }
+        
+        if (ground->GetTerrainMask()) {
+            info = GetTerrainCollisionInfo(entityBounds, ground);
+            return info.hasCollision;
         }
         
         const Rectangle groundBounds = ground->GetBounds();
         
+        // One-way platforms only catch things falling onto them from above
+        if (ground->IsOneWay()) {
+            if (entity->GetVelocityY() < 0.0f || entityBounds.center.y > groundBounds.y) {
+                return false;
+            }
+            info.hasCollision = true;
+            info.collidedGround = ground;
+            info.side = CollisionSide::Top;
+            info.penetrationDepth = (entityBounds.center.y + entityBounds.radius) - groundBounds.y;
+            info.contactCoordinate = groundBounds.y;
+            return true;
+        }
+        
         // Calculate overlaps
         const float overlapLeft = (entityBounds.center.x + entityBounds.radius) - groundBounds.x;
         const float overlapRight = (groundBounds.x + groundBounds.width) - 
@@ -380,29 +827,91 @@ CollisionInfo Game::GetGroundCollisionInfo(Entity* entity) const {
         const float minOverlapY = std::min(overlapTop, overlapBottom);
         
         info.hasCollision = true;
-        info.collidedGround = ground.get();
+        info.collidedGround = ground;
         
         if (minOverlapX < minOverlapY) {
             // X-axis collision
             if (overlapLeft < overlapRight) {
                 info.side = CollisionSide::Left;
                 info.penetrationDepth = overlapLeft;
+                info.contactCoordinate = groundBounds.x;
             } else {
                 info.side = CollisionSide::Right;
                 info.penetrationDepth = overlapRight;
+                info.contactCoordinate = groundBounds.x + groundBounds.width;
             }
         } else {
             // Y-axis collision
             if (overlapTop < overlapBottom) {
                 info.side = CollisionSide::Top;
                 info.penetrationDepth = overlapTop;
+                info.contactCoordinate = groundBounds.y;
             } else {
                 info.side = CollisionSide::Bottom;
                 info.penetrationDepth = overlapBottom;
+                info.contactCoordinate = groundBounds.y + groundBounds.height;
             }
         }
         
-        break; // Return first collision found
+        return true; // Return first collision found
+    });
+    
+    return info;
+}
+
+CollisionInfo Game::GetTerrainCollisionInfo(const Circle& bounds, Ground* ground) const {
+    CollisionInfo info{};
+    const TerrainMask* terrain = ground->GetTerrainMask();
+    if (!terrain) return info;
+    
+    const float centerX = bounds.center.x;
+    const float centerY = bounds.center.y;
+    const float radius = bounds.radius;
+    
+    info.collidedGround = ground;
+    
+    // Crater walls at centre height come first so entities do not climb through them
+    if (const auto wall = terrain->FindWall(centerY, centerX, centerX + radius);
+        wall && centerX + radius - *wall > 0.0f) {
+        info.hasCollision = true;
+        info.side = CollisionSide::Left;
+        info.penetrationDepth = centerX + radius - *wall;
+        info.contactCoordinate = *wall;
+        return info;
+    }
+    
+    if (const auto wall = terrain->FindWall(centerY, centerX, centerX - radius);
+        wall && *wall - (centerX - radius) > 0.0f) {
+        info.hasCollision = true;
+        info.side = CollisionSide::Right;
+        info.penetrationDepth = *wall - (centerX - radius);
+        info.contactCoordinate = *wall;
+        return info;
+    }
+    
+    // Floor: highest surface under the lower half of the circle, sampled at three columns
+    std::optional<float> floorY;
+    for (const float offset : {-0.5f, 0.0f, 0.5f}) {
+        const auto surface = terrain->FindSurfaceBelow(centerX + offset * radius, centerY, centerY + radius);
+        if (surface && (!floorY || *surface < *floorY)) {
+            floorY = surface;
+        }
+    }
+    
+    if (floorY) {
+        info.hasCollision = true;
+        info.side = CollisionSide::Top;
+        info.penetrationDepth = centerY + radius - *floorY;
+        info.contactCoordinate = *floorY;
+        return info;
+    }
+    
+    // Ceiling: overhangs left behind by craters
+    if (const auto ceiling = terrain->FindCeilingAbove(centerX, centerY, centerY - radius)) {
+        info.hasCollision = true;
+        info.side = CollisionSide::Bottom;
+        info.penetrationDepth = *ceiling - (centerY - radius);
+        info.contactCoordinate = *ceiling;
     }
     
     return info;
@@ -424,38 +933,48 @@ void Game::HandleGroundCollision(Entity* entity) {
         return;
     }
     
-    const CollisionInfo collision = GetGroundCollisionInfo(entity);
-    
-    if (!collision.hasCollision) {
-        if (entity->IsOnGround()) {
-            entity->SetOnGround(false);
+    // Terrain can push an entity out of a wall and onto a floor in the same tick
+    for (int pass = 0; pass < MAX_GROUND_COLLISION_PASSES; ++pass) {
+        const CollisionInfo collision = GetGroundCollisionInfo(entity);
+        
+        if (!collision.hasCollision) {
+            if (pass == 0 && entity->IsOnGround()) {
+                entity->SetOnGround(false);
+            }
+            return;
+        }
+        
+        ResolveGroundCollision(entity, collision);
+        
+        if (collision.side == CollisionSide::Top || collision.side == CollisionSide::None) {
+            return;
         }
-        return;
     }
+}
 
+void Game::ResolveGroundCollision(Entity* entity, const CollisionInfo& collision) {
     switch (collision.side) {
         case CollisionSide::Top:
             if (entity->GetVelocityY() > 0) {
                 entity->SetOnGround(true);
+                entity->SetSupport(collision.collidedGround);
                 entity->SetVelocityY(0.0f);
-                entity->SetY(collision.collidedGround->GetY() - entity->GetRadius());
+                entity->SetY(collision.contactCoordinate - entity->GetRadius());
             }
             break;
             
         case CollisionSide::Left:
-            entity->SetX(collision.collidedGround->GetX() - entity->GetRadius());
+            entity->SetX(collision.contactCoordinate - entity->GetRadius());
             break;
             
         case CollisionSide::Right:
-            entity->SetX(collision.collidedGround->GetX() + 
-                        collision.collidedGround->GetWidth() + entity->GetRadius());
+            entity->SetX(collision.contactCoordinate + entity->GetRadius());
             break;
             
         case CollisionSide::Bottom:
             if (entity->GetVelocityY() < 0) {
                 entity->SetVelocityY(0.0f);
-                entity->SetY(collision.collidedGround->GetY() + 
-                           collision.collidedGround->GetHeight() + entity->GetRadius());
+                entity->SetY(collision.contactCoordinate + entity->GetRadius());
             }
             break;
             
@@ -463,15 +982,20 @@ void Game::HandleGroundCollision(Entity* entity) {
             break;
     }
     
-    // Safety check for player getting stuck in ground
-    if (entity == m_player.get() && collision.hasCollision) {
-        const float groundSurfaceY = collision.collidedGround->GetY();
+    // Safety check for player getting stuck in ground (terrain only has a surface under the player,
+    // and a platform's sides are walls, not something to be lifted onto)
+    const bool isLevelGround =
+        std::find(m_grounds.begin(), m_grounds.end(), collision.collidedGround) != m_grounds.end();
+    const bool hasFlatSurface = isLevelGround && !collision.collidedGround->GetTerrainMask();
+    if (entity == m_player && (hasFlatSurface || collision.side == CollisionSide::Top)) {
+        const float groundSurfaceY = hasFlatSurface ? collision.collidedGround->GetY() : collision.contactCoordinate;
         const float playerBottom = entity->GetY() + entity->GetRadius();
         
         if (playerBottom > groundSurfaceY) {
             entity->SetY(groundSurfaceY - entity->GetRadius());
             entity->SetVelocityY(0.0f);
             entity->SetOnGround(true);
+            entity->SetSupport(collision.collidedGround);
         }
     }
 }
@@ -526,23 +1050,525 @@ void Game::HandleEnemyUnderMap(Enemy* enemy) {
     }
 }
 
+void Game::UpdateProjectiles() {
+    m_projectiles.Integrate(m_deltaTime, GRAVITY);
+    m_projectiles.CollideWithGround(m_groundGrid);
+    
+    // Thrown projectiles against Gobo; several landing in one tick count once
+    m_projectileTargets.assign(1, m_player->GetBounds());
+    if (m_projectiles.CollideWithTargets(ProjectileOwner::Enemy, m_projectileTargets, m_playerShotHits) > 0) {
+        m_player->TakeDamage();
+    }
+    
+    // Gobo's shots against every enemy in one pass; the kills are applied in UpdateEnemies
+    m_projectileTargets.clear();
+    for (const Enemy* enemy : m_enemies) {
+        m_projectileTargets.push_back(enemy->GetBounds());
+    }
+    m_projectiles.CollideWithTargets(ProjectileOwner::Player, m_projectileTargets, m_enemyShotHits);
+    
+    m_projectiles.RemoveDead();
+}
+
 void Game::RemoveEnemy(Enemy* enemy) {
-    const auto it = std::find_if(m_enemies.begin(), m_enemies.end(),
-        [enemy](const std::unique_ptr<Enemy>& ptr) {
-            return ptr.get() == enemy;
-        });
+    // Removal is deferred to the end of UpdateEnemies so the enemy stays valid this tick
+    const auto it = std::find(m_enemies.begin(), m_enemies.end(), enemy);
+    if (it == m_enemies.end()) {
+        return;
+    }
     
-    if (it != m_enemies.end()) {
-        m_enemies.erase(it);
+    const std::size_t index = static_cast<std::size_t>(it - m_enemies.begin());
+    if (std::find(m_enemiesToRemove.begin(), m_enemiesToRemove.end(), index) == m_enemiesToRemove.end()) {
+        m_enemiesToRemove.push_back(index);
     }
 }
 
-int Game::GenerateRandomInt(int min, int max) {
-    thread_local static std::random_device randomDevice;
-    thread_local static std::mt19937 generator(randomDevice());
+// Creates directory if needed and returns directory/prefix_YYYYmmdd_HHMMSS + extension
+std::string Game::MakeTimestampedPath(const char* directory, const char* prefix, const char* extension) {
+    char timestamp[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+    
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    
+    return std::string(directory) + "/" + prefix + "_" + timestamp + extension;
+}
+
+void Game::ToggleFrameCapture() {
+    if (m_frameCapture.IsRecording()) {
+        m_frameCapture.Stop();
+        return;
+    }
+    
+    // Shift+F9 dumps individual QOI frames, plain F9 records a GIF
+    const bool dumpFrames = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+    
+    const std::string basePath = MakeTimestampedPath("captures", "gobo", "");
+    if (dumpFrames) {
+        (void)m_frameCapture.Start(basePath, CaptureFormat::QoiFrames);
+    } else {
+        (void)m_frameCapture.Start(basePath + ".gif", CaptureFormat::Gif);
+    }
+}
+
+void Game::RecordFrameTiming(GameState state, double tickSeconds) noexcept {
+    const std::size_t stateIndex = static_cast<std::size_t>(state);
+    m_frameTimeHistograms[stateIndex].RecordSeconds(m_frameSeconds);
+    m_tickTimeHistograms[stateIndex].RecordSeconds(tickSeconds);
+}
+
+void Game::RecordFrameGraphTiming() noexcept {
+    // A cancelled run skipped part of the tick, so its timings would read short
+    if (m_frameGraph.WasCancelled()) return;
+    
+    for (std::size_t i = 0; i < m_frameGraph.GetTaskCount(); ++i) {
+        m_frameTaskHistograms[i].RecordSeconds(m_frameGraph.GetTaskSeconds(i));
+        if (m_frameGraph.IsOnCriticalPath(i)) {
+            ++m_frameTaskCriticalCounts[i];
+        }
+    }
+    m_frameCriticalPathHistogram.RecordSeconds(m_frameGraph.GetCriticalPathSeconds());
+    m_frameTaskWorkHistogram.RecordSeconds(m_frameGraph.GetWorkSeconds());
+    m_frameGraphWallHistogram.RecordSeconds(m_frameGraph.GetWallSeconds());
+}
+
+const char* Game::GetGameStateName(GameState state) noexcept {
+    switch (state) {
+        case GameState::MainMenu: return "MainMenu";
+        case GameState::Playing:  return "Playing";
+        case GameState::GameOver: return "GameOver";
+        case GameState::Controls: return "Controls";
+        case GameState::Options:  return "Options";
+        case GameState::AskExit:  return "AskExit";
+        case GameState::Paused:   return "Paused";
+        case GameState::Exit:     return "Exit";
+    }
+    return "Unknown";
+}
+
+void Game::WriteFrameTimingSummary() const {
+    const std::string path = MakeTimestampedPath("stats", "session", ".json");
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Warning: Could not write frame timing summary to " << path << std::endl;
+        return;
+    }
+    
+    // Values are reported in milliseconds; percentiles carry the histogram's < 0.8% error
+    auto writeHistogram = [&file](const char* name, const LatencyHistogram& histogram) {
+        file << "\"" << name << "\":{\"count\":" << histogram.GetTotalCount()
+             << ",\"mean\":" << histogram.GetMeanMicroseconds() / 1000.0
+             << ",\"p50\":" << histogram.GetPercentileMicroseconds(50.0) / 1000.0
+             << ",\"p90\":" << histogram.GetPercentileMicroseconds(90.0) / 1000.0
+             << ",\"p99\":" << histogram.GetPercentileMicroseconds(99.0) / 1000.0
+             << ",\"p999\":" << histogram.GetPercentileMicroseconds(99.9) / 1000.0
+             << ",\"max\":" << histogram.GetMaxMicroseconds() / 1000.0 << "}";
+    };
+    
+    file << std::fixed << std::setprecision(3);
+    file << "{\"unit\":\"ms\",\"durationSeconds\":" << (GetTime() - m_sessionStartTime) << ",\"states\":{";
     
+    bool firstState = true;
+    for (std::size_t i = 0; i < GAME_STATE_COUNT; ++i) {
+        if (m_frameTimeHistograms[i].IsEmpty()) continue;
+        
+        file << (firstState ? "" : ",") << "\"" << GetGameStateName(static_cast<GameState>(i)) << "\":{";
+        writeHistogram("frame", m_frameTimeHistograms[i]);
+        file << ",";
+        writeHistogram("tick", m_tickTimeHistograms[i]);
+        if (!m_renderTimeHistograms[i].IsEmpty()) {
+            file << ",";
+            writeHistogram("render", m_renderTimeHistograms[i]);
+        }
+        file << "}";
+        firstState = false;
+    }
+    file << "}";
+    
+    // Playing tick task graph: the critical path bounds the tick however many workers
+    // there are, and each task's criticalShare is how often it was on that path
+    if (!m_frameGraphWallHistogram.IsEmpty()) {
+        file << ",\"frameGraph\":{\"workers\":" << m_frameGraph.GetWorkerCount() << ",";
+        writeHistogram("criticalPath", m_frameCriticalPathHistogram);
+        file << ",";
+        writeHistogram("work", m_frameTaskWorkHistogram);
+        file << ",";
+        writeHistogram("wall", m_frameGraphWallHistogram);
+        file << ",\"tasks\":{";
+        
+        const double runCount = static_cast<double>(m_frameGraphWallHistogram.GetTotalCount());
+        for (std::size_t i = 0; i < m_frameTaskHistograms.size(); ++i) {
+            file << (i == 0 ? "" : ",") << "\"" << m_frameGraph.GetTaskName(i) << "\":{";
+            writeHistogram("time", m_frameTaskHistograms[i]);
+            file << ",\"criticalShare\":" << m_frameTaskCriticalCounts[i] / runCount << "}";
+        }
+        file << "}}";
+    }
+    
+    // GPU time per render pass, to set against the CPU render times above: a GPU
+    // frame well over the CPU one means the frame is fill-bound, not draw-call bound
+    if (!m_gpuTimer.GetFrameHistogram().IsEmpty()) {
+        file << ",\"gpu\":{\"dropped\":" << m_gpuTimer.GetDroppedFrameCount() << ",";
+        writeHistogram("frame", m_gpuTimer.GetFrameHistogram());
+        file << ",\"passes\":{";
+        
+        bool firstPass = true;
+        for (std::size_t i = 0; i < GPU_PASS_COUNT; ++i) {
+            const GpuPass pass = static_cast<GpuPass>(i);
+            if (m_gpuTimer.GetPassHistogram(pass).IsEmpty()) continue;
+            file << (firstPass ? "" : ",");
+            writeHistogram(GpuTimer::GetPassName(pass), m_gpuTimer.GetPassHistogram(pass));
+            firstPass = false;
+        }
+        file << "}}";
+    }
+    
+    file << "}\n";
+}
+
+void Game::InstallFlightRecorder() {
+    // The dump is written from a signal handler, so the directory is created up front here
+    m_flightRecorder.Install(MakeTimestampedPath("crashes", "flight", ".gfr"));
+}
+
+void Game::RecordFlightFrame(GameState state, double updateSeconds, double renderSeconds) noexcept {
+    FlightRecord record;
+    record.frameIndex = m_frameIndex++;
+    record.deltaTime = m_deltaTime;
+    record.gameState = static_cast<std::uint8_t>(state);
+    record.input = m_input;
+    record.screenWidth = static_cast<std::int16_t>(m_currentWindowWidth);
+    record.screenHeight = static_cast<std::int16_t>(m_currentWindowHeight);
+    
+    // The first simulated frame of a session carries the seed needed to replay it
+    if (m_sessionStartPending && state == GameState::Playing) {
+        record.flags |= FlightRecord::FLAG_SESSION_START;
+        record.sessionSeed = m_sessionSeed;
+        m_sessionStartPending = false;
+    }
+    
+    if (m_player) {
+        record.playerX = m_player->GetX();
+        record.playerY = m_player->GetY();
+        record.playerRadius = m_player->GetRadius();
+        record.killCount = m_player->GetKillCount();
+    }
+    record.enemyCount = static_cast<std::uint16_t>(m_enemies.size());
+    record.explosionCount = static_cast<std::uint16_t>(m_explosionManager.GetTotalExplosionCount());
+    if (state == GameState::Playing) {
+        record.stateHash = m_lastStateHash.combined;
+    }
+    
+    record.zoneMicroseconds[static_cast<std::size_t>(FlightZone::Update)] =
+        static_cast<std::uint32_t>(updateSeconds * 1.0e6);
+    record.zoneMicroseconds[static_cast<std::size_t>(FlightZone::Render)] =
+        static_cast<std::uint32_t>(renderSeconds * 1.0e6);
+    
+    m_flightRecorder.Record(record);
+}
+
+bool Game::StartReplay(const std::string& dumpPath) {
+    FlightDumpHeader header;
+    std::vector<FlightRecord> records;
+    if (!FlightRecorder::LoadDump(dumpPath, header, records)) {
+        return false;
+    }
+    
+    // Only a session whose first frame is still in the ring can be re-simulated
+    const auto sessionStart = std::find_if(records.rbegin(), records.rend(), [](const FlightRecord& record) {
+        return (record.flags & FlightRecord::FLAG_SESSION_START) != 0;
+    });
+    if (sessionStart == records.rend()) {
+        std::cerr << "Flight recorder dump has no session start to replay from: " << dumpPath << std::endl;
+        return false;
+    }
+    
+    m_replayRecords = std::move(records);
+    m_replayCursor = static_cast<std::size_t>(std::distance(sessionStart, m_replayRecords.rend())) - 1;
+    m_isReplaying = true;
+    m_replayDiverged = false;
+    m_replayExpectedHash = 0;
+    
+    // World layout depends on the window size the session was recorded with
+    const FlightRecord& first = m_replayRecords[m_replayCursor];
+    if (first.screenWidth != m_currentWindowWidth || first.screenHeight != m_currentWindowHeight) {
+        SetWindowSize(first.screenWidth, first.screenHeight);
+        m_currentWindowWidth = first.screenWidth;
+        m_currentWindowHeight = first.screenHeight;
+        m_camera.offset = {m_currentWindowWidth / 2.0f, m_currentWindowHeight / 2.0f};
+    }
+    
+    ResetGame();
+    RestartGame();
+    return true;
+}
+
+void Game::StartBenchmark(bool exitWhenDone) {
+    m_exitAfterBenchmark = exitWhenDone;
+    m_maxEnemiesBeforeBenchmark = m_maxEnemies;
+    m_benchmark.Start();
+    
+    // Frame times are only comparable without the 60 FPS cap
+    SetTargetFPS(0);
+    
+    ResetGame();
+    RestartGame();
+}
+
+bool Game::UpdateBenchmark() {
+    if (!m_benchmark.Advance(m_deltaTime)) {
+        FinishBenchmark(true);
+        return false;
+    }
+    
+    // The current phase dictates the enemy load
+    const BenchmarkPhase& phase = m_benchmark.GetCurrentPhase();
+    m_maxEnemies = phase.maxEnemies;
+    m_enemySpawnInterval = phase.enemySpawnInterval;
+    
+    // Scripted explosions land on the ground around the camera, carving the terrain as they go
+    if (m_benchmark.ConsumeExplosionTrigger() && !m_grounds.empty()) {
+        const int halfWidth = m_currentWindowWidth / 2;
+        const Vector2 position = {
+            m_camera.target.x + static_cast<float>(GenerateRandomInt(-halfWidth, halfWidth)),
+            m_grounds[0]->GetY() - static_cast<float>(GenerateRandomInt(0, 60))
+        };
+        m_explosionManager.CreateExplosion(position, m_explosionSound, m_soundEnabled);
+    }
+    
+    return true;
+}
+
+void Game::FinishBenchmark(bool completed) {
+    m_benchmark.Cancel();
+    m_maxEnemies = m_maxEnemiesBeforeBenchmark;
+    SetTargetFPS(60);
+    
+    if (completed) {
+        const HardwareInfo hardware = HardwareInfo::Describe();
+        m_benchmark.WriteSummary(std::cout, hardware);
+        m_lastBenchmarkScore = m_benchmark.ComputeScore();
+        
+        const std::string path = MakeTimestampedPath("benchmarks", "benchmark", ".json");
+        if (m_benchmark.SaveReport(path, hardware)) {
+            std::cout << "Benchmark report saved to " << path << std::endl;
+        }
+    } else {
+        std::cout << "Benchmark cancelled" << std::endl;
+    }
+    
+    if (m_exitAfterBenchmark) {
+        m_currentGameState = GameState::Exit;
+    } else {
+        m_currentGameState = GameState::MainMenu;
+        m_resetGame = true;
+    }
+}
+
+bool Game::EnableStateHashLog(const std::string& path) {
+    const std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(parent, error);
+    }
+    return m_stateHashLog.Open(path);
+}
+
+bool Game::EnableSpectatorServer(std::uint16_t port) {
+    return m_spectatorServer.Open(port);
+}
+
+bool Game::EnableGpuTimers() {
+    if (!m_gpuTimer.Start()) {
+        std::cerr << "GPU timer queries are not supported by this GL context" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void Game::PublishSpectatorSnapshot() {
+    using SpectatorProtocol::Entity;
+    using SpectatorProtocol::EntityKind;
+    
+    m_spectatorServer.Poll();
+    if (!m_spectatorServer.IsSnapshotDue() || !m_player || m_grounds.empty() || !m_finishLine) return;
+    
+    auto quantize = [](float value, float scale) {
+        return static_cast<std::int32_t>(std::lround(value * scale));
+    };
+    auto quantizeRadius = [](float radius) {
+        return static_cast<std::uint16_t>(std::clamp(std::lround(radius * SpectatorProtocol::RADIUS_SCALE), 0l, 0xFFFFl));
+    };
+    
+    SpectatorProtocol::Snapshot& snapshot = m_spectatorServer.BeginSnapshot();
+    snapshot.killCount = m_player->GetKillCount();
+    
+    const Rectangle groundBounds = m_grounds[0]->GetBounds();
+    const Rectangle finishBounds = m_finishLine->GetBounds();
+    snapshot.layout = {
+        quantize(groundBounds.x, 1.0f), quantize(groundBounds.y, 1.0f),
+        quantize(groundBounds.width, 1.0f), quantize(groundBounds.height, 1.0f),
+        quantize(finishBounds.x, 1.0f), quantize(finishBounds.y, 1.0f),
+        quantize(finishBounds.width, 1.0f), quantize(finishBounds.height, 1.0f)
+    };
+    
+    // Key order: player first, enemies sorted by serial below, then emitters by slot
+    Entity player;
+    player.key = SpectatorProtocol::MakeKey(EntityKind::Player, 0);
+    player.x = quantize(m_player->GetX(), SpectatorProtocol::POSITION_SCALE);
+    player.y = quantize(m_player->GetY(), SpectatorProtocol::POSITION_SCALE);
+    player.radius = quantizeRadius(m_player->GetRadius());
+    player.frame = static_cast<std::uint8_t>(m_player->GetCurrentFrame());
+    player.flags = m_player->CanUseBomb() ? Entity::FLAG_BOMB_READY : 0;
+    snapshot.entities.push_back(player);
+    
+    const std::size_t firstEnemy = snapshot.entities.size();
+    for (const Enemy* enemy : m_enemies) {
+        Entity entity;
+        entity.key = SpectatorProtocol::MakeKey(EntityKind::Enemy, enemy->GetSerialNumber());
+        entity.x = quantize(enemy->GetX(), SpectatorProtocol::POSITION_SCALE);
+        entity.y = quantize(enemy->GetY(), SpectatorProtocol::POSITION_SCALE);
+        entity.radius = quantizeRadius(enemy->GetRadius());
+        entity.frame = static_cast<std::uint8_t>(enemy->GetCurrentFrame());
+        entity.flags = static_cast<std::uint8_t>(static_cast<std::uint8_t>(enemy->GetArchetype()) << 4);
+        if (enemy->GetDirection() == EnemyDirection::Left) entity.flags |= Entity::FLAG_FACING_LEFT;
+        snapshot.entities.push_back(entity);
+    }
+    // Pool reuse and serial wrap-around can put enemies out of spawn order
+    std::sort(snapshot.entities.begin() + static_cast<std::ptrdiff_t>(firstEnemy), snapshot.entities.end(),
+              [](const Entity& a, const Entity& b) { return a.key < b.key; });
+    
+    const std::vector<Explosion>& explosions = m_explosionManager.GetExplosions();
+    for (std::size_t i = 0; i < explosions.size(); ++i) {
+        if (!explosions[i].IsActive()) continue;
+        Entity emitter;
+        emitter.key = SpectatorProtocol::MakeKey(EntityKind::Emitter, static_cast<std::uint16_t>(i));
+        emitter.x = quantize(explosions[i].GetPosition().x, SpectatorProtocol::POSITION_SCALE);
+        emitter.y = quantize(explosions[i].GetPosition().y, SpectatorProtocol::POSITION_SCALE);
+        emitter.radius = quantizeRadius(explosions[i].GetRadius());
+        emitter.frame = static_cast<std::uint8_t>(std::clamp(explosions[i].GetProgress(), 0.0f, 1.0f) * 255.0f);
+        snapshot.entities.push_back(emitter);
+    }
+    
+    m_spectatorServer.SendSnapshot();
+}
+
+void Game::UpdateStateHash() {
+    // Only simulation state goes in; explosion particles are cosmetic and seeded
+    // per process, so they are left out and can't cause false alarms
+    StateHashRecord record;
+    record.tick = m_sessionTick++;
+    
+    auto fieldHash = [&record](StateHashField field) -> std::uint64_t& {
+        return record.fields[static_cast<std::size_t>(field)];
+    };
+    
+    if (m_player) {
+        StateHasher player;
+        player.Add(m_player->GetX());
+        player.Add(m_player->GetY());
+        player.Add(m_player->GetVelocityY());
+        player.Add(m_player->GetRadius());
+        player.Add(m_player->GetSizeScale());
+        player.Add(m_player->GetKillCount());
+        player.Add(m_player->IsOnGround());
+        player.Add(m_player->CanUseBomb());
+        fieldHash(StateHashField::Player) = player.Get();
+    }
+    
+    // Enemy order is hashed too, so iteration-order differences show up
+    StateHasher enemies;
+    enemies.Add(m_enemies.size());
+    for (const Enemy* enemy : m_enemies) {
+        enemies.Add(enemy->GetX());
+        enemies.Add(enemy->GetY());
+        enemies.Add(enemy->GetVelocityY());
+        enemies.Add(enemy->GetRadius());
+        enemies.Add(enemy->GetDirection());
+        enemies.Add(enemy->GetArchetype());
+        enemies.Add(enemy->IsOnGround());
+    }
+    fieldHash(StateHashField::Enemies) = enemies.Get();
+    
+    StateHasher explosions;
+    for (const Explosion& explosion : m_explosionManager.GetExplosions()) {
+        if (!explosion.IsActive()) continue;
+        explosions.Add(explosion.GetPosition().x);
+        explosions.Add(explosion.GetPosition().y);
+        explosions.Add(explosion.GetProgress());
+    }
+    fieldHash(StateHashField::Explosions) = explosions.Get();
+    
+    StateHasher projectiles;
+    projectiles.Add(m_projectiles.GetCount());
+    for (std::size_t i = 0; i < m_projectiles.GetCount(); ++i) {
+        projectiles.Add(m_projectiles.GetPosition(i).x);
+        projectiles.Add(m_projectiles.GetPosition(i).y);
+        projectiles.Add(m_projectiles.GetOwner(i));
+    }
+    fieldHash(StateHashField::Projectiles) = projectiles.Get();
+    
+    fieldHash(StateHashField::Terrain) = m_terrainHasher.Get();
+    
+    StateHasher timers;
+    timers.Add(m_deltaTime);
+    timers.Add(m_enemySpawnTimer);
+    timers.Add(m_enemySpawnInterval);
+    timers.Add(m_enemyBuffTimer);
+    timers.Add(m_enemyScale);
+    timers.Add(m_gameHardness);
+    timers.Add(m_enemiesSpawned);
+    timers.Add(m_camera.target.x); // Enemies spawn relative to the camera
+    timers.Add(m_platforms.GetTime()); // Platform positions follow from it
+    fieldHash(StateHashField::Timers) = timers.Get();
+    
+    StateHasher random;
+    random.Add(m_sessionSeed);
+    random.Add(m_randomDrawCount);
+    fieldHash(StateHashField::Random) = random.Get();
+    
+    StateHasher combined;
+    for (const std::uint64_t field : record.fields) {
+        combined.Mix(field);
+    }
+    record.combined = combined.Get();
+    
+    m_lastStateHash = record;
+    m_stateHashLog.Append(record);
+    
+    // A replay carries the hash of every recorded tick, so divergence is caught live
+    if (m_isReplaying && !m_replayDiverged && m_replayExpectedHash != 0 &&
+        m_replayExpectedHash != record.combined) {
+        std::cerr << "Warning: Replay diverged from the recording at tick " << record.tick << std::endl;
+        m_replayDiverged = true;
+    }
+}
+
+void Game::AdvanceReplay() {
+    const bool hasRecord = m_replayCursor < m_replayRecords.size();
+    const bool recordIsPlaying = hasRecord &&
+        m_replayRecords[m_replayCursor].gameState == static_cast<std::uint8_t>(GameState::Playing);
+    
+    if (!recordIsPlaying || m_currentGameState != GameState::Playing) {
+        std::cout << "Replay finished after " << m_replayCursor << " of "
+                  << m_replayRecords.size() << " recorded frames" << std::endl;
+        m_isReplaying = false;
+        m_replayRecords.clear();
+        return;
+    }
+    
+    const FlightRecord& record = m_replayRecords[m_replayCursor++];
+    m_input = record.input;
+    m_deltaTime = record.deltaTime; // Simulation only; frame timing stats keep m_frameSeconds
+    m_replayExpectedHash = record.stateHash;
+}
+
+int Game::GenerateRandomInt(int min, int max) {
+    // Seeded per session (see SeedSession) so replays reproduce enemy spawns
     std::uniform_int_distribution<int> distribution(min, max);
-    return distribution(generator);
+    ++m_randomDrawCount;
+    return distribution(m_randomGenerator);
 }
 
 bool Game::AreColorsEqual(Color color1, Color color2) const noexcept {
@@ -606,24 +1632,24 @@ std::string Game::GetColorName(Color color) const {
 }
 
 void Game::HandleMainMenuInput() {
-    const std::size_t menuButtonCount = 4;
+    const std::size_t menuButtonCount = 5;
     
     // Navigate menu options
     if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
-        if (m_soundEnabled) PlaySound(m_hoverButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
         m_selectedMainMenuOption = (m_selectedMainMenuOption == 0) ? 
             menuButtonCount - 1 : m_selectedMainMenuOption - 1;
     }
     
     if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
-        if (m_soundEnabled) PlaySound(m_hoverButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
         m_selectedMainMenuOption = (m_selectedMainMenuOption == menuButtonCount - 1) ? 
             0 : m_selectedMainMenuOption + 1;
     }
     
     // Select option
     if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER) || IsKeyPressed(KEY_SPACE)) {
-        if (m_soundEnabled) PlaySound(m_openButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_openButtonSound);
         
         switch (m_selectedMainMenuOption) {
             case 0: // START GAME
@@ -636,8 +1662,11 @@ void Game::HandleMainMenuInput() {
             case 2: // OPTIONS
                 m_currentGameState = GameState::Options;
                 break;
-            case 3: // EXIT
-                if (m_soundEnabled) PlaySound(m_exitNoSound);
+            case 3: // BENCHMARK
+                StartBenchmark(false);
+                break;
+            case 4: // EXIT
+                if (m_soundEnabled) AudioCommands::PlaySound(m_exitNoSound);
                 m_currentGameState = GameState::AskExit;
                 break;
         }
@@ -645,7 +1674,7 @@ void Game::HandleMainMenuInput() {
     
     // Quick exit with ESC
     if (IsKeyPressed(KEY_ESCAPE)) {
-        if (m_soundEnabled) PlaySound(m_exitNoSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_exitNoSound);
         m_currentGameState = GameState::AskExit;
     }
 }
@@ -653,7 +1682,7 @@ void Game::HandleMainMenuInput() {
 void Game::HandleControlsMenuInput() {
     if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_SPACE) || 
         IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER)) {
-        if (m_soundEnabled) PlaySound(m_backButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
         m_currentGameState = GameState::MainMenu;
     }
 }
@@ -663,20 +1692,20 @@ void Game::HandleOptionsMenuInput() {
     
     // Navigate menu options
     if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
-        if (m_soundEnabled) PlaySound(m_hoverButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
         m_selectedOptionsMenuOption = (m_selectedOptionsMenuOption == 0) ? 
             optionsCount - 1 : m_selectedOptionsMenuOption - 1;
     }
     
     if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
-        if (m_soundEnabled) PlaySound(m_hoverButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
         m_selectedOptionsMenuOption = (m_selectedOptionsMenuOption == optionsCount - 1) ? 
             0 : m_selectedOptionsMenuOption + 1;
     }
     
     // Modify selected option values
     if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) {
-        if (m_soundEnabled) PlaySound(m_openButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_openButtonSound);
         
         switch (m_selectedOptionsMenuOption) {
             case 0: // Max Enemies
@@ -695,11 +1724,11 @@ void Game::HandleOptionsMenuInput() {
     }
     
     if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) {
-        if (m_soundEnabled) PlaySound(m_openButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_openButtonSound);
         
         switch (m_selectedOptionsMenuOption) {
             case 0: // Max Enemies
-                if (m_maxEnemies < 20) m_maxEnemies++;
+                if (m_maxEnemies < MAX_ENEMIES_LIMIT) m_maxEnemies++;
                 break;
             case 1: // Background Color
                 CycleToNextBackgroundColor();
@@ -715,7 +1744,7 @@ void Game::HandleOptionsMenuInput() {
     
     // Go back to main menu
     if (IsKeyPressed(KEY_ESCAPE)) {
-        if (m_soundEnabled) PlaySound(m_backButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
         m_currentGameState = GameState::MainMenu;
     }
 }
@@ -723,21 +1752,21 @@ void Game::HandleOptionsMenuInput() {
 void Game::HandleGameOverMenuInput() {
     // Navigate menu options
     if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
-        if (m_soundEnabled) PlaySound(m_hoverButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
         m_selectedGameOverMenuOption = (m_selectedGameOverMenuOption == 0) ? 1 : 0;
     }
     if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
-        if (m_soundEnabled) PlaySound(m_hoverButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
         m_selectedGameOverMenuOption = (m_selectedGameOverMenuOption == 1) ? 0 : 1;
     }
     
     // Select option
     if (IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER)) {
-        if (m_soundEnabled) PlaySound(m_openButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_openButtonSound);
         if (m_selectedGameOverMenuOption == 0) { // Play Again
             RestartGame();
         } else { // Main Menu
-            if (m_soundEnabled) PlaySound(m_backButtonSound);
+            if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
             ResetGame();
             m_currentGameState = GameState::MainMenu;
         }
@@ -745,12 +1774,42 @@ void Game::HandleGameOverMenuInput() {
     
     // Quick shortcuts
     if (IsKeyPressed(KEY_ESCAPE)) {
-        if (m_soundEnabled) PlaySound(m_backButtonSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
         ResetGame();
         m_currentGameState = GameState::MainMenu;
     }
 }
 
+void Game::HandlePauseMenuInput() {
+    // Navigate menu options
+    if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
+        m_selectedPauseMenuOption = (m_selectedPauseMenuOption == 0) ? 1 : 0;
+    }
+    if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
+        if (m_soundEnabled) AudioCommands::PlaySound(m_hoverButtonSound);
+        m_selectedPauseMenuOption = (m_selectedPauseMenuOption == 1) ? 0 : 1;
+    }
+    
+    // Select option
+    if (IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER)) {
+        if (m_selectedPauseMenuOption == 0) { // Resume
+            if (m_soundEnabled) AudioCommands::PlaySound(m_openButtonSound);
+            m_currentGameState = GameState::Playing;
+        } else { // Main Menu
+            if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
+            m_currentGameState = GameState::MainMenu;
+            m_resetGame = true;
+        }
+    }
+    
+    // ESC resumes, like most games' pause screens
+    if (IsKeyPressed(KEY_ESCAPE)) {
+        if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
+        m_currentGameState = GameState::Playing;
+    }
+}
+
 void Game::HandleExitMenuInput() {
     // Navigate menu options
     if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
@@ -763,103 +1822,269 @@ void Game::HandleExitMenuInput() {
     // Select option
     if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER) || IsKeyPressed(KEY_SPACE)) {
         if (m_selectedExitMenuOption == 0) { // "Yes!?" - Exit the game
-            if (m_soundEnabled) PlaySound(m_exitDisappointingSound);
+            if (m_soundEnabled) AudioCommands::PlaySound(m_exitDisappointingSound);
             m_shouldExit = true;
         } else { // "No!" - Go back to main menu
             m_shouldExit = false;
-            if (m_soundEnabled) PlaySound(m_backButtonSound);
+            if (m_soundEnabled) AudioCommands::PlaySound(m_backButtonSound);
             m_currentGameState = GameState::MainMenu;
         }
     }
     
     // ESC key defaults to "Yes!?" behavior
     if (IsKeyPressed(KEY_ESCAPE)) {
-        if (m_soundEnabled) PlaySound(m_exitDisappointingSound);
+        if (m_soundEnabled) AudioCommands::PlaySound(m_exitDisappointingSound);
         m_shouldExit = true;
     }
 }
 
-void Game::UpdateGame() {
+void Game::BuildFrameGraph() {
+    using Resource = FrameResource;
+    m_frameGraph.Clear();
+    
+    // Added in the order the tick used to run serially, so the results are the same;
+    // only tasks whose declared resources don't conflict overlap
+    m_frameGraph.AddTask("Camera", MakeResourceMask(Resource::Player, Resource::Terrain),
+                         MakeResourceMask(Resource::Camera), [this] { UpdateCamera(); });
+    
+    // Touches everything, so it is a barrier; ending the benchmark leaves Playing and
+    // skips the rest of the tick. It writes files and sets the frame rate, hence main thread.
+    m_frameGraph.AddTask("Benchmark", ALL_FRAME_RESOURCES, ALL_FRAME_RESOURCES, [this] {
+        if (m_benchmark.IsRunning() && !UpdateBenchmark()) {
+            m_frameGraph.Cancel();
+        }
+    }, true);
+    
+    m_frameGraph.AddTask("Platforms", 0, MakeResourceMask(Resource::Terrain, Resource::Player, Resource::Enemies),
+                         [this] {
+        if (!m_player) return;
+        m_platforms.Update(m_deltaTime, m_groundGrid);
+        CarryEntities();
+    });
+    m_frameGraph.AddTask("Spawning", MakeResourceMask(Resource::Camera, Resource::Session),
+                         MakeResourceMask(Resource::Enemies, Resource::Random), [this] { SpawnEnemies(); });
+    m_frameGraph.AddTask("EnemyAI", MakeResourceMask(Resource::Player, Resource::Terrain),
+                         MakeResourceMask(Resource::Enemies, Resource::Projectiles), [this] { UpdateEnemyAI(); });
+    m_frameGraph.AddTask("PlayerInput", MakeResourceMask(Resource::Input, Resource::Terrain),
+                         MakeResourceMask(Resource::Player, Resource::Explosions, Resource::Projectiles,
+                                          Resource::Audio), [this] {
+        if (!m_player) return;
+        m_player->HandleInput(m_input, m_deltaTime, m_grounds[0]->GetBounds(),
+                              m_explosionManager, m_projectiles, m_explosionSound, m_soundEnabled);
+    });
+    m_frameGraph.AddTask("Craters", 0, MakeResourceMask(Resource::Explosions, Resource::Terrain), [this] {
+        if (m_player) CarveExplosionCraters();
+    });
+    m_frameGraph.AddTask("Difficulty", 0, MakeResourceMask(Resource::Session), [this] {
+        if (m_player) UpdateDifficulty();
+    });
+    m_frameGraph.AddTask("PlayerPhysics", MakeResourceMask(Resource::Terrain), MakeResourceMask(Resource::Player), [this] {
+        if (!m_player) return;
+        ApplyGravity(m_player);
+        HandleGroundCollision(m_player);
+        HandlePlayerCrush();
+    });
+    m_frameGraph.AddTask("Explosions", 0, MakeResourceMask(Resource::Explosions), [this] {
+        if (m_player) m_explosionManager.Update(m_deltaTime);
+    });
+    m_frameGraph.AddTask("Projectiles", MakeResourceMask(Resource::Terrain, Resource::Enemies),
+                         MakeResourceMask(Resource::Projectiles, Resource::Player), [this] {
+        if (m_player) UpdateProjectiles();
+    });
+    m_frameGraph.AddTask("GameOver", 0, MakeResourceMask(Resource::Session, Resource::Player, Resource::Audio,
+                                                         Resource::Ghosts), [this] { CheckGameOver(); });
+    m_frameGraph.AddTask("Enemies", MakeResourceMask(Resource::Session, Resource::Explosions, Resource::Projectiles,
+                                                     Resource::Terrain),
+                         MakeResourceMask(Resource::Enemies, Resource::Player), [this] { UpdateEnemies(); });
+    
+    // Animation still runs on the tick that ends the game
+    m_frameGraph.AddTask("PlayerAnimation", 0, MakeResourceMask(Resource::Player), [this] {
+        if (!m_player) return;
+        m_player->Update(m_deltaTime);
+        
+        // Keep player from falling below screen
+        if (m_player->GetY() > m_currentWindowHeight) {
+            m_player->SetY(static_cast<float>(m_currentWindowHeight) / 2.0f);
+        }
+    });
+    // Records the animated pose; playback only moves the cursors, nothing is simulated
+    m_frameGraph.AddTask("Ghosts", MakeResourceMask(Resource::Player), MakeResourceMask(Resource::Ghosts),
+                         [this] { UpdateGhosts(); });
+    m_frameGraph.AddTask("EnemyAnimation", 0, MakeResourceMask(Resource::Enemies), [this] {
+        for (Enemy* enemy : m_enemies) {
+            if (enemy) {
+                enemy->Update(m_deltaTime);
+            }
+        }
+    });
+    
+    m_frameGraph.AddTask("Diagnostics", ALL_FRAME_RESOURCES, MakeResourceMask(Resource::Diagnostics), [this] {
+        if (m_currentGameState == GameState::Playing) {
+            UpdateStateHash();
+            PublishSpectatorSnapshot();
+        }
+    });
+    
+    m_frameTaskHistograms.assign(m_frameGraph.GetTaskCount(), LatencyHistogram());
+    m_frameTaskCriticalCounts.assign(m_frameGraph.GetTaskCount(), 0);
+    m_frameGraph.Start(std::min(ThreadTuning::GetWorkerCount(), MAX_FRAME_GRAPH_WORKERS));
+}
+
+void Game::UpdateCamera() {
     if (!m_player) return;
     
-    m_player->HandleInput(m_deltaTime, m_grounds[0]->GetBounds(),
-                         m_explosionManager, m_explosionSound, m_soundEnabled);
+    // Update camera to follow player
+    const float targetX = m_player->GetX();
+    const float groundBottom = static_cast<float>(m_currentWindowHeight);
+    const float targetY = groundBottom - m_camera.offset.y;
+    
+    // Clamp camera to map boundaries if needed
+    const float halfScreenWidth = m_currentWindowWidth / 2.0f;
+    const float groundLeft = m_grounds[0]->GetX();
+    const float groundRight = m_grounds[0]->GetX() + m_grounds[0]->GetWidth();
+    
+    float clampedTargetX = targetX;
+    if (m_grounds[0]->GetWidth() >= m_currentWindowWidth) {
+        const float minCameraX = groundLeft + halfScreenWidth;
+        const float maxCameraX = groundRight - halfScreenWidth;
+        clampedTargetX = Clamp(targetX, minCameraX, maxCameraX);
+    }
+    
+    m_camera.target.x = Lerp(m_camera.target.x, clampedTargetX, 0.1f);
+    m_camera.target.y = targetY;
+}
 
+void Game::UpdateDifficulty() noexcept {
     // Enemy scaling and difficulty progression
-    static float enemyBuffTimer = 0.0f;
-    enemyBuffTimer += m_deltaTime;
+    m_enemyBuffTimer += m_deltaTime;
 
-    if (enemyBuffTimer >= 5.0f) {
+    if (m_enemyBuffTimer >= 5.0f) {
         if (m_enemyScale < MAX_ENTITY_SCALE) {
             m_enemyScale *= 1.1f;
         } else if (m_gameHardness < MAX_GAME_HARDNESS) {
             m_gameHardness *= 1.1f;
         }
-        enemyBuffTimer = 0.0f;
+        m_enemyBuffTimer = 0.0f;
     }
+}
 
-    // Apply physics to player
-    ApplyGravity(m_player.get());
-    HandleGroundCollision(m_player.get());
-
-    // Update explosions
-    m_explosionManager.Update(m_deltaTime);
-
-    // Check game over condition early
-    if (m_player->GetRadius() <= TEXTURE_RESOLUTION) {
+void Game::CheckGameOver() {
+    if (!m_player || m_player->GetRadius() > TEXTURE_RESOLUTION) return;
+    
+    if (!m_benchmark.IsRunning()) {
         SetGameOver();
         return;
     }
+    
+    // The benchmark scene always runs its full length, so Gobo respawns instead
+    const Vector2 playerStart = GetPlayerSpawnPosition();
+    m_player->Respawn(playerStart.x, playerStart.y);
+}
 
-    // Collect enemies to remove (avoids repeated searches in RemoveEnemy)
-    std::vector<size_t> enemiesToRemove;
-    enemiesToRemove.reserve(m_enemies.size() / 4); // Reserve some space to avoid allocations
+void Game::UpdateEnemies() {
+    // Enemies stop interacting on the tick the game ends
+    if (!m_player || m_currentGameState != GameState::Playing) return;
+    
+    // Enemies to remove this tick (member buffer, reserved once per session)
+    m_enemiesToRemove.clear();
+    const auto isMarkedForRemoval = [this](std::size_t index) {
+        return !m_enemiesToRemove.empty() && m_enemiesToRemove.back() == index;
+    };
 
     // Update all enemies and check for removals in a single pass
     for (size_t i = 0; i < m_enemies.size(); ++i) {
-        Enemy* enemy = m_enemies[i].get();
+        Enemy* enemy = m_enemies[i];
         if (!enemy) continue;
 
-        // Check explosion damage
-        if (m_explosionManager.CheckExplosionDamage(enemy->GetCenter(), enemy->GetRadius())) {
+        // Check shot and explosion damage
+        if (m_enemyShotHits[i] != 0 ||
+            m_explosionManager.CheckExplosionDamage(enemy->GetCenter(), enemy->GetRadius())) {
             m_player->IncrementKillCount();
-            enemiesToRemove.push_back(i);
+            m_enemiesToRemove.push_back(i);
             continue; // Skip physics/collision for dead enemies
         }
+        if (FindCrushingPlatform(enemy)) {
+            m_enemiesToRemove.push_back(i);
+            continue;
+        }
 
         // Apply physics
-        ApplyGravity(enemy);
+        ApplyGravity(enemy, enemy->GetGravityScale());
         HandleGroundCollision(enemy);
 
-        // Handle collisions
+        // Handle collisions (each handler may mark the enemy for removal)
         HandleEnemyCollision(enemy);
+        if (isMarkedForRemoval(i)) continue;
         HandleFinishLineCollision(enemy);
+        if (isMarkedForRemoval(i)) continue;
         HandleEnemyUnderMap(enemy);
     }
 
     // Remove dead enemies in reverse order to maintain valid indices
-    for (auto it = enemiesToRemove.rbegin(); it != enemiesToRemove.rend(); ++it) {
-        m_enemies.erase(m_enemies.begin() + *it);
+    std::sort(m_enemiesToRemove.begin(), m_enemiesToRemove.end());
+    for (auto it = m_enemiesToRemove.rbegin(); it != m_enemiesToRemove.rend(); ++it) {
+        Enemy* enemy = m_enemies[*it];
+        
+        // Batches are unordered, so swap-and-pop keeps them dense
+        std::vector<Enemy*>& batch = m_enemiesByArchetype[static_cast<std::size_t>(enemy->GetArchetype())];
+        if (const auto batchIt = std::find(batch.begin(), batch.end(), enemy); batchIt != batch.end()) {
+            *batchIt = batch.back();
+            batch.pop_back();
+        }
+        
+        m_enemyPool.Release(enemy);
+        m_enemies.erase(m_enemies.begin() + static_cast<std::ptrdiff_t>(*it));
     }
+    m_enemiesToRemove.clear();
 }
 
 void Game::ResetGame() {
-    // Clear all game objects
-    m_player.reset();
-    m_enemies.clear();
+    // Release every session object at once; storage is kept for the next session
+    m_player = nullptr;
+    ClearEnemies();
     m_grounds.clear();
-    m_finishLine.reset();
-    
-    // Reset game variables
+    m_platforms.Clear();
+    m_finishLine = nullptr;
+    m_enemyPool.Reset();
+    m_sessionArena.Reset();
+    m_explosionManager.Clear();
+    m_projectiles.Clear();
+    
+    ResetSessionVariables();
+}
+
+void Game::ResetSessionVariables() noexcept {
     m_enemyScale = START_TEXTURE_SCALE;
     m_enemySpawnTimer = 0.0f;
     m_enemySpawnInterval = 4.0f;
     m_gameHardness = 0.5f;
+    m_enemyBuffTimer = 0.0f;
+    m_enemiesSpawned = 0;
+    m_enemiesToRemove.clear();
 }
 
 void Game::RestartGame() {
-    ResetGame();
-    InitializeEntities();
+    if (!m_player || m_grounds.empty() || !m_finishLine) {
+        ResetGame();
+        InitializeEntities();
+    } else {
+        // Reinitialise the running session in place; only enemies go back to the pool
+        for (Enemy* enemy : m_enemies) {
+            m_enemyPool.Release(enemy);
+        }
+        ClearEnemies();
+        m_explosionManager.Clear();
+        m_projectiles.Clear();
+        ResetSessionVariables();
+        m_platforms.ResetTime();
+        
+        LayoutWorld();
+        const Vector2 playerStart = GetPlayerSpawnPosition();
+        m_player->Respawn(playerStart.x, playerStart.y);
+        
+        SeedSession();
+        StartGhostSession();
+    }
     
     // Reset camera to player position
     if (m_player) {
@@ -873,11 +2098,69 @@ void Game::RestartGame() {
 }
 
 void Game::SetGameOver() {
-    if (m_soundEnabled) PlaySound(m_loseSound);
+    SubmitGhostRun();
+    if (m_soundEnabled) AudioCommands::PlaySound(m_loseSound);
     m_selectedGameOverMenuOption = 0;
     m_currentGameState = GameState::GameOver;
 }
 
+void Game::StartGhostSession() {
+    m_ghostCursors.clear();
+    m_ghostTime = 0.0f;
+    
+    // Benchmark and replay sessions aren't real runs, and their scenes stay as they were
+    if (m_benchmark.IsRunning() || m_isReplaying) {
+        m_ghostRecorder.Stop();
+        return;
+    }
+    
+    m_ghostRecorder.Start();
+    m_ghostCursors.reserve(m_ghostLibrary.GetRunCount());
+    for (std::size_t rank = 0; rank < m_ghostLibrary.GetRunCount(); ++rank) {
+        m_ghostCursors.emplace_back(m_ghostLibrary.GetRun(rank).track);
+    }
+}
+
+void Game::UpdateGhosts() {
+    if (!m_player || m_currentGameState != GameState::Playing) return;
+    
+    // Both sides use the time at the start of the tick, so a ghost is where its run was on the same tick
+    for (GhostCursor& cursor : m_ghostCursors) {
+        (void)cursor.Seek(m_ghostTime);
+    }
+    
+    GhostPose pose;
+    const Vector2 origin = GetGhostOrigin();
+    pose.position = {m_player->GetX() - origin.x, m_player->GetY() - origin.y};
+    pose.sizeScale = m_player->GetSizeScale();
+    pose.frame = static_cast<std::uint8_t>(m_player->GetCurrentFrame());
+    m_ghostRecorder.Update(m_deltaTime, pose);
+    
+    m_ghostTime += m_deltaTime;
+}
+
+void Game::SubmitGhostRun() {
+    if (!m_ghostRecorder.IsRecording() || !m_player) return;
+    m_ghostRecorder.Stop();
+    
+    GhostRun run;
+    run.killCount = m_player->GetKillCount();
+    run.track = m_ghostRecorder.GetTrack();
+    
+    // The cursors point into the library, which may be about to change
+    m_ghostCursors.clear();
+    if (m_ghostLibrary.Submit(std::move(run)) >= GhostLibrary::MAX_RUNS) return;
+    
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(GHOST_LIBRARY_PATH).parent_path(), error);
+    (void)m_ghostLibrary.Save(GHOST_LIBRARY_PATH);
+}
+
+Vector2 Game::GetGhostOrigin() const noexcept {
+    // Middle of the ground's top edge, which LayoutWorld keeps fixed relative to the window
+    return {m_currentWindowWidth / 2.0f, m_currentWindowHeight - GetGroundHeight()};
+}
+
 void Game::DrawMainMenu() {
     // Implementation similar to original but with member variables
     DrawRectangle(0, 0, m_currentWindowWidth, m_currentWindowHeight, Fade(BLACK, 0.8f));
@@ -914,7 +2197,7 @@ void Game::DrawMainMenu() {
     const float titleSpacing = Clamp(static_cast<float>(m_currentWindowHeight) / 30.0f, 15.0f, 40.0f);
     
     const float totalMenuHeight = titleFontSize + subtitleFontSize + titleSpacing + 
-                                 (4 * buttonHeight) + (3 * buttonSpacing);
+                                 (5 * buttonHeight) + (4 * buttonSpacing);
     
     float menuStartY = centerY - (totalMenuHeight / 2.0f);
     if (menuStartY < minMargin) {
@@ -933,7 +2216,7 @@ void Game::DrawMainMenu() {
     const float buttonWidth = Clamp(static_cast<float>(m_currentWindowWidth) / 4.0f, 150.0f, 300.0f);
     const float buttonStartY = menuStartY + titleFontSize + subtitleFontSize + titleSpacing;
     
-    const std::array<const char*, 4> buttonTexts = {"START GAME", "CONTROLS", "OPTIONS", "EXIT"};
+    const std::array<const char*, 5> buttonTexts = {"START GAME", "CONTROLS", "OPTIONS", "BENCHMARK", "EXIT"};
     
     for (std::size_t i = 0; i < buttonTexts.size(); ++i) {
         const Rectangle buttonBounds = {
@@ -953,6 +2236,191 @@ void Game::DrawMainMenu() {
                  static_cast<int>(buttonHeight * 0.75f),
                  WHITE);
     }
+    
+    // Result of the last benchmark run, for comparing against other machines
+    if (m_lastBenchmarkScore) {
+        const std::string scoreText = TextFormat("Last benchmark score: %.0f", *m_lastBenchmarkScore);
+        const int scoreFontSize = subtitleFontSize;
+        const int scoreWidth = MeasureText(scoreText.c_str(), scoreFontSize);
+        DrawText(scoreText.c_str(), static_cast<int>(centerX - scoreWidth / 2),
+                 m_currentWindowHeight - scoreFontSize - static_cast<int>(minMargin), scoreFontSize, LIGHTGRAY);
+    }
+}
+
+void Game::RenderLights() {
+    // Offscreen pass; DrawWorld composites the result over the world
+    m_gpuTimer.BeginPass(GpuPass::Lights);
+    m_lightBuffer.Begin(m_renderCamera);
+    m_explosionManager.AddLights(m_lightBuffer);
+    if (m_player) m_player->AddLights(m_lightBuffer);
+    m_lightBuffer.End();
+}
+
+void Game::DrawWorld() {
+    // Push this frame's craters to the terrain texture before it is drawn
+    m_terrain.UploadDirtyRegion();
+    
+    // Game rendering with camera
+    BeginMode2D(m_renderCamera);
+    
+    // Draw world objects; baked tiles go through their chunk meshes
+    m_gpuTimer.BeginPass(GpuPass::Ground);
+    for (const Ground* ground : m_grounds) {
+        if (ground && (!m_groundMesh.IsReady() || ground->HasReadyTerrain())) ground->Draw();
+    }
+    m_groundMesh.Draw(GetVisibleWorldArea());
+    m_platforms.Draw(GetVisibleWorldArea());
+
+    m_gpuTimer.BeginPass(GpuPass::Sprites);
+    DrawGhosts(GetVisibleWorldArea());
+    DrawPlayer();
+    m_gpuTimer.BeginPass(GpuPass::Ground);
+    if (m_finishLineMesh.IsReady()) {
+        m_finishLineMesh.Draw(GetVisibleWorldArea());
+    } else if (m_finishLine) {
+        m_finishLine->Draw();
+    }
+    
+    m_gpuTimer.BeginPass(GpuPass::Sprites);
+    DrawEnemies(GetVisibleWorldArea());
+
+    m_projectiles.Draw(GetVisibleWorldArea());
+    m_gpuTimer.BeginPass(GpuPass::Particles);
+    if (m_renderCamera.zoom <= EXPLOSION_GLOW_MAX_ZOOM) {
+        m_explosionManager.DrawGlow(m_glowTexture);
+    } else {
+        m_explosionManager.Draw();
+    }
+    
+    EndMode2D();
+    m_gpuTimer.BeginPass(GpuPass::Composite);
+    m_lightBuffer.Composite();
+
+    // Draw UI
+    m_gpuTimer.BeginPass(GpuPass::Ui);
+    if (m_player) {
+        const std::string playerKills = "Kills: " + std::to_string(m_player->GetKillCount());
+        int killsFontSize = 40;
+        const int killsWidth = MeasureText(playerKills.c_str(), killsFontSize);
+        killsFontSize = (killsWidth > m_currentWindowWidth/3) ? 
+                       (killsFontSize * (m_currentWindowWidth/3) / killsWidth) : killsFontSize;
+        DrawText(playerKills.c_str(), 20, 20, killsFontSize, MAROON);
+    }
+    
+    if (m_overviewEnabled) {
+        const int overviewWidth = MeasureText("OVERVIEW (Tab)", 20);
+        DrawText("OVERVIEW (Tab)", (m_currentWindowWidth - overviewWidth) / 2, 20, 20, DARKBLUE);
+    }
+    
+    if (m_benchmark.IsRunning()) {
+        const BenchmarkPhase& phase = m_benchmark.GetCurrentPhase();
+        const char* benchmarkText = TextFormat("BENCHMARK %d/%d: %s  %3.0f%%",
+            static_cast<int>(m_benchmark.GetPhaseIndex() + 1), static_cast<int>(BENCHMARK_PHASE_COUNT),
+            phase.name, m_benchmark.GetProgress() * 100.0f);
+        const int benchmarkWidth = MeasureText(benchmarkText, 20);
+        DrawText(benchmarkText, m_currentWindowWidth - benchmarkWidth - 20, 20, 20, GOLD);
+    }
+}
+
+void Game::DrawFrozenWorld() {
+    // Nothing moves behind the pause and game-over menus, so the world is
+    // rendered once into a texture on entry and later frames draw one quad
+    if (!m_isFrozenFrameValid) {
+        if (m_frozenFrame.texture.width != m_currentWindowWidth ||
+            m_frozenFrame.texture.height != m_currentWindowHeight) {
+            if (m_frozenFrame.id != 0) UnloadRenderTexture(m_frozenFrame);
+            m_frozenFrame = LoadRenderTexture(m_currentWindowWidth, m_currentWindowHeight);
+        }
+        if (m_frozenFrame.id == 0) {
+            RenderLights();
+            DrawWorld();
+            return;
+        }
+        
+        RenderLights(); // Its own texture mode, so not nested in the capture
+        BeginTextureMode(m_frozenFrame);
+        ClearBackground(m_backgroundColor);
+        DrawWorld();
+        EndTextureMode();
+        m_isFrozenFrameValid = true;
+    }
+    
+    // Render textures are stored bottom-up
+    m_gpuTimer.BeginPass(GpuPass::Composite);
+    const Rectangle source = {0.0f, 0.0f, static_cast<float>(m_frozenFrame.texture.width),
+                              -static_cast<float>(m_frozenFrame.texture.height)};
+    DrawTextureRec(m_frozenFrame.texture, source, {0.0f, 0.0f}, WHITE);
+}
+
+void Game::DrawPlayer() const {
+    if (!m_player) return;
+
+    const float radius = m_player->GetRadius();
+    if (radius * 2.0f * m_renderCamera.zoom < IMPOSTOR_MAX_SCREEN_DIAMETER) {
+        DrawRectangleV({m_player->GetX() - radius, m_player->GetY() - radius}, {radius * 2.0f, radius * 2.0f},
+                       m_playerImpostorColor);
+        return;
+    }
+    m_player->Draw(TEXTURE_RESOLUTION, m_currentWindowHeight, m_currentWindowWidth);
+}
+
+void Game::DrawGhosts(const Rectangle& visibleArea) const {
+    if (m_ghostCursors.empty() || m_playerTextures.empty()) return;
+    
+    const Vector2 origin = GetGhostOrigin();
+    const float baseRadius = GetPlayerBaseRadius();
+    const Rectangle source = {0.0f, 0.0f, static_cast<float>(TEXTURE_RESOLUTION), static_cast<float>(TEXTURE_RESOLUTION)};
+    
+    // Worst first, so the best run ends up on top
+    for (auto cursor = m_ghostCursors.rbegin(); cursor != m_ghostCursors.rend(); ++cursor) {
+        if (cursor->IsFinished()) continue;
+        
+        const GhostPose pose = cursor->GetPose();
+        const float radius = baseRadius * pose.sizeScale;
+        const Rectangle bounds = {origin.x + pose.position.x - radius, origin.y + pose.position.y - radius,
+                                  radius * 2.0f, radius * 2.0f};
+        if (!CheckCollisionRecs(bounds, visibleArea)) continue;
+        
+        if (bounds.width * m_renderCamera.zoom < IMPOSTOR_MAX_SCREEN_DIAMETER) {
+            DrawRectangleRec(bounds, Fade(m_playerImpostorColor, GHOST_ALPHA));
+            continue;
+        }
+        const std::size_t frame = std::min<std::size_t>(pose.frame, m_playerTextures.size() - 1);
+        DrawTexturePro(m_playerTextures[frame], source, bounds, {0.0f, 0.0f}, 0.0f, Fade(WHITE, GHOST_ALPHA));
+    }
+}
+
+void Game::DrawEnemies(const Rectangle& visibleArea) const {
+    // Enemies only a few pixels across on screen skip their sprites and go
+    // into one flat-colour quad batch afterwards, with no texture switches
+    const float impostorRadius = IMPOSTOR_MAX_SCREEN_DIAMETER / (2.0f * m_renderCamera.zoom);
+    auto isVisible = [&visibleArea](const Enemy* enemy) {
+        return enemy && CheckCollisionCircleRec({enemy->GetX(), enemy->GetY()}, enemy->GetRadius(), visibleArea);
+    };
+
+    bool hasImpostors = false;
+    for (const Enemy* enemy : m_enemies) {
+        if (!isVisible(enemy)) continue;
+        if (enemy->GetRadius() < impostorRadius) {
+            hasImpostors = true;
+            continue;
+        }
+        enemy->Draw(TEXTURE_RESOLUTION, m_currentWindowHeight, m_currentWindowWidth);
+    }
+    if (!hasImpostors) return;
+
+    rlSetTexture(rlGetTextureIdDefault());
+    rlBegin(RL_QUADS);
+    QuadWriter quads;
+    quads.Begin();
+    for (const Enemy* enemy : m_enemies) {
+        if (!isVisible(enemy) || enemy->GetRadius() >= impostorRadius) continue;
+        const Color tint = GetEnemyArchetypeParams(enemy->GetArchetype()).tint;
+        quads.Add({enemy->GetX(), enemy->GetY()}, enemy->GetRadius(), ColorTint(m_enemyImpostorColor, tint));
+    }
+    quads.Finish();
+    rlEnd();
+    rlSetTexture(0);
 }
 
 void Game::DrawControlsMenu() {
@@ -977,7 +2445,7 @@ void Game::DrawControlsMenu() {
     }
     
     // Calculate total height and positioning
-    const float totalHeight = titleFontSize + (controlTextFontSize * 4) + backFontSize + 80;
+    const float totalHeight = titleFontSize + (controlTextFontSize * 7) + backFontSize + 80;
     float menuStartY = centerY - (totalHeight / 2.0f);
     
     if (menuStartY < minMargin) {
@@ -988,10 +2456,13 @@ void Game::DrawControlsMenu() {
     DrawText(title, static_cast<int>(centerX - titleWidth/2), static_cast<int>(menuStartY), titleFontSize, RED);
     
     // Control instructions
-    const std::array<const char*, 3> controls = {
+    const std::array<const char*, 6> controls = {
         "Movement: Arrow Keys and W,A,S,D",
         "Bomb: Space",
-        "End Game: Escape Key"
+        "Shoot: F (hold to keep firing)",
+        "Overview: Tab",
+        "Pause: Escape Key",
+        "Record GIF: F9 (Shift+F9 for frames)"
     };
     
     const float controlStartY = menuStartY + titleFontSize + 40;
@@ -1024,7 +2495,7 @@ void Game::DrawControlsMenu() {
     
     DrawText(exitText, 
             static_cast<int>(centerX - backTextWidth/2),
-            static_cast<int>(controlStartY + (3 * lineSpacing) + 40), 
+            static_cast<int>(controlStartY + (controls.size() * lineSpacing) + 40), 
             backFontSize, 
             GRAY);
 }
@@ -1242,6 +2713,67 @@ void Game::DrawGameOverMenu() {
     }
 }
 
+void Game::DrawPauseMenu() {
+    DrawRectangle(0, 0, m_currentWindowWidth, m_currentWindowHeight, Fade(BLACK, 0.6f));
+    
+    const float centerX = m_currentWindowWidth / 2.0f;
+    const float centerY = m_currentWindowHeight / 2.0f;
+    const float minMargin = 20.0f;
+    const float availableWidth = m_currentWindowWidth - (minMargin * 2);
+    
+    // Calculate responsive font sizes
+    int titleFontSize = Clamp(m_currentWindowWidth / 12, 30, 80);
+    const int buttonFontSize = Clamp(m_currentWindowWidth / 25, 16, 32);
+    
+    // Calculate button dimensions
+    const float buttonWidth = Clamp(static_cast<float>(m_currentWindowWidth) / 3.0f, 200.0f, 400.0f);
+    const float buttonHeight = Clamp(static_cast<float>(m_currentWindowHeight) / 15.0f, 35.0f, 60.0f);
+    
+    // Title
+    const char* title = "PAUSED";
+    const int titleWidth = MeasureText(title, titleFontSize);
+    
+    if (titleWidth > availableWidth) {
+        titleFontSize = static_cast<int>((titleFontSize * availableWidth) / titleWidth);
+    }
+    
+    // Calculate positioning
+    const float totalHeight = titleFontSize + (2 * buttonHeight) + 80;
+    float menuStartY = centerY - (totalHeight / 2.0f);
+    
+    if (menuStartY < minMargin) {
+        menuStartY = minMargin;
+    }
+    
+    // Draw title
+    DrawText(title, static_cast<int>(centerX - titleWidth/2), static_cast<int>(menuStartY), titleFontSize, GOLD);
+    
+    // Create and draw buttons
+    const float buttonStartY = menuStartY + titleFontSize + 40;
+    const std::array<const char*, 2> buttonTexts = {"RESUME", "MAIN MENU"};
+    
+    for (std::size_t i = 0; i < buttonTexts.size(); ++i) {
+        const Rectangle buttonBounds = {
+            centerX - buttonWidth/2, 
+            buttonStartY + i * (buttonHeight + 20), 
+            buttonWidth, 
+            buttonHeight
+        };
+        
+        const Color btnColor = (i == m_selectedPauseMenuOption) ? LIME : DARKGRAY;
+        DrawRectangleRounded(buttonBounds, 0.3f, 0, btnColor);
+        
+        const int textWidth = MeasureText(buttonTexts[i], buttonFontSize);
+        const Color textColor = (i == m_selectedPauseMenuOption) ? BLACK : WHITE;
+        
+        DrawText(buttonTexts[i],
+                static_cast<int>(buttonBounds.x + (buttonBounds.width - textWidth) / 2),
+                static_cast<int>(buttonBounds.y + (buttonBounds.height - buttonFontSize) / 2),
+                buttonFontSize,
+                textColor);
+    }
+}
+
 void Game::DrawExitMenu() {
     DrawRectangle(0, 0, m_currentWindowWidth, m_currentWindowHeight, Fade(BLACK, 0.8f));
     
@@ -1407,213 +2939,254 @@ void Game::DrawOptionsInstructions(float currentY, float centerX, float availabl
 }
 
 void Game::Run() {
-    while (!WindowShouldClose() && m_currentGameState != GameState::Exit) {
-        m_deltaTime = GetFrameTime();
-        UpdateMusicStream(m_backgroundMusic);
-        SetMusicVolume(m_backgroundMusic, m_musicVolume);
-        
-        // Update window dimensions
-        const int newWidth = GetScreenWidth();
-        const int newHeight = GetScreenHeight();
-        const bool windowResized = (newWidth != m_currentWindowWidth || newHeight != m_currentWindowHeight);
-        
-        if (windowResized) {
-            m_currentWindowWidth = newWidth;
-            m_currentWindowHeight = newHeight;
-            m_mapWidth = static_cast<int>(m_currentWindowWidth * 1.5f);
-            m_mapHeight = static_cast<int>(m_currentWindowHeight * 1.5f);
+    try {
+        while (!WindowShouldClose() && m_currentGameState != GameState::Exit) {
+            if (IsInBackground()) {
+                if (!m_isBackgrounded) EnterBackground();
+                // One more frame lets the pause go through recorded input, then nothing is drawn
+                if (!m_isBackgroundPausePending) {
+                    WaitInBackground();
+                    continue;
+                }
+            } else if (m_isBackgrounded) {
+                LeaveBackground();
+            }
+            RunFrame();
+        }
+    } catch (const std::exception& e) {
+        m_flightRecorder.DumpException(e.what());
+        throw;
+    } catch (...) {
+        m_flightRecorder.DumpException("unknown exception");
+        throw;
+    }
+}
+
+bool Game::IsInBackground() const noexcept {
+    // Benchmarks and replays need every frame, and may well run without focus
+    if (m_benchmark.IsRunning() || m_isReplaying) return false;
+    return IsWindowMinimized() || !IsWindowFocused();
+}
+
+void Game::EnterBackground() {
+    m_isBackgrounded = true;
+    m_isBackgroundPausePending = m_currentGameState == GameState::Playing && m_player;
+    
+    if (!m_keepMusicInBackground && !m_isBackgroundMusicPaused) {
+        // RunFrame resumes it once the window is back, if music is still enabled
+        AudioCommands::PauseMusic(m_backgroundMusic);
+        m_isBackgroundMusicPaused = true;
+    }
+    
+    // PollInputEvents now blocks until the window system has something for us
+    EnableEventWaiting();
+}
+
+void Game::LeaveBackground() {
+    m_isBackgrounded = false;
+    DisableEventWaiting();
+}
+
+void Game::WaitInBackground() {
+    // Sleeps in the event wait, then caps how often a stream of events (mouse
+    // moves over the window, say) can wake the loop; no frame is drawn either way
+    PollInputEvents();
+    WaitTime(BACKGROUND_POLL_INTERVAL);
+}
+
+void Game::RunFrame() {
+    m_frameSeconds = GetFrameTime();
+    m_deltaTime = m_frameSeconds;
+    m_input = InputFrame::Sample();
+    if (m_isBackgroundPausePending) {
+        // Pressing Back for the player keeps the pause in the flight record, so replays match
+        if (m_currentGameState == GameState::Playing && m_player) {
+            m_input.pressed |= static_cast<std::uint8_t>(InputButton::Back);
+        }
+        m_isBackgroundPausePending = false;
+    }
+    if (m_isReplaying) {
+        AdvanceReplay();
+    }
+    if (m_benchmark.IsRunning()) {
+        // Measure the real frame, but simulate a fixed step so every machine does the same work
+        m_benchmark.RecordFrame(m_frameSeconds);
+        m_deltaTime = Benchmark::FIXED_DELTA_TIME;
+        m_input = m_benchmark.GetScriptedInput(m_input);
+    }
+    if (IsKeyPressed(KEY_F9)) {
+        ToggleFrameCapture();
+    }
+    if (IsKeyPressed(KEY_F5)) {
+        LoadBehaviourScripts(); // Enemy AI changes without a restart
+    }
+    if (IsKeyPressed(KEY_TAB) && m_currentGameState == GameState::Playing) {
+        m_overviewEnabled = !m_overviewEnabled; // View only, so not part of the recorded input
+    }
+    if (m_musicVolume != m_sentMusicVolume) {
+        AudioCommands::SetMusicVolume(m_backgroundMusic, m_musicVolume);
+        m_sentMusicVolume = m_musicVolume;
+    }
+    
+    // Update window dimensions
+    const int newWidth = GetScreenWidth();
+    const int newHeight = GetScreenHeight();
+    const bool windowResized = (newWidth != m_currentWindowWidth || newHeight != m_currentWindowHeight);
+    
+    if (windowResized) {
+        m_currentWindowWidth = newWidth;
+        m_currentWindowHeight = newHeight;
+        m_mapWidth = static_cast<int>(m_currentWindowWidth * 1.5f);
+        m_mapHeight = static_cast<int>(m_currentWindowHeight * 1.5f);
+        
+        // Update camera offset
+        m_camera.offset = {m_currentWindowWidth/2.0f, m_currentWindowHeight/2.0f};
+        m_isFrozenFrameValid = false; // Re-captured at the new size
+        if (!m_lightBuffer.Resize(m_currentWindowWidth, m_currentWindowHeight)) {
+            std::cerr << "Warning: Failed to resize the light buffer, glow is disabled" << std::endl;
+        }
+        
+        // Handle game-specific resize logic
+        if (m_currentGameState == GameState::Playing && !m_grounds.empty()) {
+            LayoutWorld();
+        }
+    }
+
+    // Handle music; the frame that pauses a backgrounded game must not resume it
+    if (m_musicEnabled && m_isBackgroundMusicPaused && !m_isBackgrounded) {
+        AudioCommands::ResumeMusic(m_backgroundMusic);
+        m_isBackgroundMusicPaused = false;
+    } else if (!m_musicEnabled && !m_isBackgroundMusicPaused) {
+        AudioCommands::PauseMusic(m_backgroundMusic);
+        m_isBackgroundMusicPaused = true;
+    }
+    
+    // State-specific updates
+    const GameState tickState = m_currentGameState;
+    const double tickStartTime = GetTime();
+    
+    switch (m_currentGameState) {
+        case GameState::MainMenu:
+            if (m_resetGame) {
+                ResetGame();
+                m_resetGame = false;
+            }
+            m_musicVolume = Lerp(m_musicVolume, 1.0f, 0.25f);
+            HandleMainMenuInput();
+            break;
             
-            // Update camera offset
-            m_camera.offset = {m_currentWindowWidth/2.0f, m_currentWindowHeight/2.0f};
+        case GameState::Controls:
+            HandleControlsMenuInput();
+            break;
             
-            // Handle game-specific resize logic
-            if (m_currentGameState == GameState::Playing && !m_grounds.empty()) {
-                const float groundHeight = GetGroundHeight();
-                const float groundY = m_currentWindowHeight - groundHeight;
-                const float newGroundX = (m_currentWindowWidth - m_mapWidth) / 2.0f;
-                
-                m_grounds[0]->SetBounds({newGroundX, groundY, static_cast<float>(m_mapWidth), groundHeight});
-                
-                if (m_finishLine) {
-                    const float finishLineWidth = (m_finishLineTexture.id != 0) ? 
-                        m_finishLineTexture.width * FINISH_LINE_WIDTH : 200.0f;
-                    const float finishLineHeight = (m_finishLineTexture.id != 0) ? 
-                        static_cast<float>(m_finishLineTexture.height) : 50.0f;
+        case GameState::Options:
+            HandleOptionsMenuInput();
+            break;
+            
+        case GameState::Playing:
+            if (m_player) {
+                if (m_input.WasPressed(InputButton::Back)) {
+                    if (m_soundEnabled && !m_isBackgrounded) AudioCommands::PlaySound(m_backButtonSound);
                     
-                    const float finishLineX = (m_currentWindowWidth / 2.0f) - (finishLineWidth / 2.0f);
-                    const float finishLineY = groundY - finishLineHeight;
+                    // A pause would skew the timings, so ESC still abandons a benchmark
+                    if (m_benchmark.IsRunning()) {
+                        m_currentGameState = GameState::MainMenu;
+                        m_resetGame = true;
+                        FinishBenchmark(false);
+                        break;
+                    }
                     
-                    m_finishLine->SetPosition(finishLineX, finishLineY);
+                    m_player->StopWalkSound();
+                    m_selectedPauseMenuOption = 0;
+                    m_currentGameState = GameState::Paused;
+                    break;
                 }
+                
+                m_musicVolume = Lerp(m_musicVolume, 0.25f, 0.25f);
             }
-        }
-
-        // Handle music
-        if (m_musicEnabled && !IsMusicStreamPlaying(m_backgroundMusic)) {
-            ResumeMusicStream(m_backgroundMusic);
-        } else if (!m_musicEnabled && IsMusicStreamPlaying(m_backgroundMusic)) {
-            PauseMusicStream(m_backgroundMusic);
-        }
+            
+            // Camera, spawning, AI, physics and animation, overlapped where their resources allow
+            m_frameGraph.Run();
+            RecordFrameGraphTiming();
+            break;
+            
+        case GameState::GameOver:
+            m_musicVolume = 0.0f;
+            HandleGameOverMenuInput();
+            break;
+            
+        case GameState::Paused:
+            m_musicVolume = Lerp(m_musicVolume, 0.1f, 0.25f);
+            HandlePauseMenuInput();
+            break;
+            
+        case GameState::AskExit:
+            m_musicVolume = 0.0f;
+            HandleExitMenuInput();
+            if (m_shouldExit && !AudioCommands::IsSoundPlaying(m_exitDisappointingSound)) {
+                m_currentGameState = GameState::Exit;
+            }
+            break;
+            
+        case GameState::Exit:
+            break;
+    }
+    
+    const double renderStartTime = GetTime();
+    const double updateSeconds = renderStartTime - tickStartTime;
+    RecordFrameTiming(tickState, updateSeconds);
+    
+    // Rendering
+    double renderSeconds = 0.0;
+    if (m_currentGameState == GameState::Playing) {
+        UpdateRenderCamera(GetFrameTime());
+    }
+    if (m_currentGameState != GameState::Exit) {
+        BeginDrawing();
+        m_gpuTimer.BeginFrame();
+        m_gpuTimer.BeginPass(GpuPass::Ui); // Menus are all UI; the world marks its own passes
+        ClearBackground(m_backgroundColor);
         
-        // State-specific updates
         switch (m_currentGameState) {
             case GameState::MainMenu:
-                if (m_resetGame) {
-                    ResetGame();
-                    m_resetGame = false;
-                }
-                m_musicVolume = Lerp(m_musicVolume, 1.0f, 0.25f);
-                HandleMainMenuInput();
+                DrawMainMenu();
                 break;
-                
             case GameState::Controls:
-                HandleControlsMenuInput();
+                DrawControlsMenu();
                 break;
-                
             case GameState::Options:
-                HandleOptionsMenuInput();
+                DrawOptionsMenu();
+                break;
+            case GameState::AskExit:
+                DrawExitMenu();
                 break;
-                
             case GameState::Playing:
-                if (m_player) {
-                    if (IsKeyPressed(KEY_ESCAPE)) {
-                        if (m_soundEnabled) PlaySound(m_backButtonSound);
-                        m_currentGameState = GameState::MainMenu;
-                        m_resetGame = true;
-                    }
-                    
-                    m_musicVolume = Lerp(m_musicVolume, 0.25f, 0.25f);
-                    
-                    // Update camera to follow player
-                    const float targetX = m_player->GetX();
-                    const float groundBottom = static_cast<float>(m_currentWindowHeight);
-                    const float targetY = groundBottom - m_camera.offset.y;
-                    
-                    // Clamp camera to map boundaries if needed
-                    const float halfScreenWidth = m_currentWindowWidth / 2.0f;
-                    const float groundLeft = m_grounds[0]->GetX();
-                    const float groundRight = m_grounds[0]->GetX() + m_grounds[0]->GetWidth();
-                    
-                    float clampedTargetX = targetX;
-                    if (m_grounds[0]->GetWidth() >= m_currentWindowWidth) {
-                        const float minCameraX = groundLeft + halfScreenWidth;
-                        const float maxCameraX = groundRight - halfScreenWidth;
-                        clampedTargetX = Clamp(targetX, minCameraX, maxCameraX);
-                    }
-                    
-                    m_camera.target.x = Lerp(m_camera.target.x, clampedTargetX, 0.1f);
-                    m_camera.target.y = targetY;
-                }
-                
-                SpawnEnemies();
-                
-                // Enemy AI
-                for (auto& enemy : m_enemies) {
-                    if (enemy && m_player) {
-                        enemy->ExecuteAI(m_deltaTime, static_cast<float>(m_mapWidth), 
-                                       m_finishLine->GetX() + m_finishLine->GetWidth()/2, 
-                                       *m_player, m_soundEnabled);
-                    }
-                }
-                
-                UpdateGame();
-                
-                if (m_player) {
-                    m_player->Update(m_deltaTime);
-                    
-                    // Keep player from falling below screen
-                    if (m_player->GetY() > m_currentWindowHeight) {
-                        m_player->SetY(static_cast<float>(m_currentWindowHeight) / 2.0f);
-                    }
-                }
-                
-                // Update enemies
-                for (auto& enemy : m_enemies) {
-                    if (enemy) {
-                        enemy->Update(m_deltaTime);
-                    }
-                }
+                m_isFrozenFrameValid = false;
+                RenderLights();
+                DrawWorld();
                 break;
-                
-            case GameState::GameOver:
-                m_musicVolume = 0.0f;
-                HandleGameOverMenuInput();
+            case GameState::Paused:
+                DrawFrozenWorld();
+                m_gpuTimer.BeginPass(GpuPass::Ui);
+                DrawPauseMenu();
                 break;
-                
-            case GameState::AskExit:
-                m_musicVolume = 0.0f;
-                HandleExitMenuInput();
-                if (m_shouldExit && !IsSoundPlaying(m_exitDisappointingSound)) {
-                    m_currentGameState = GameState::Exit;
-                }
+            case GameState::GameOver:
+                DrawFrozenWorld();
+                m_gpuTimer.BeginPass(GpuPass::Ui);
+                DrawGameOverMenu();
                 break;
-                
             case GameState::Exit:
                 break;
         }
-        
-        // Rendering
-        if (m_currentGameState != GameState::Exit) {
-            BeginDrawing();
-            ClearBackground(m_backgroundColor);
-            
-            switch (m_currentGameState) {
-                case GameState::MainMenu:
-                    DrawMainMenu();
-                    break;
-                case GameState::Controls:
-                    DrawControlsMenu();
-                    break;
-                case GameState::Options:
-                    DrawOptionsMenu();
-                    break;
-                case GameState::AskExit:
-                    DrawExitMenu();
-                    break;
-                case GameState::Playing:
-                case GameState::GameOver:
-                    // Game rendering with camera
-                    BeginMode2D(m_camera);
-                    
-                    // Draw world objects
-                    for (const auto& ground : m_grounds) {
-                        if (ground) ground->Draw();
-                    }
-
-                    if (m_player) m_player->Draw(TEXTURE_RESOLUTION, m_currentWindowHeight, m_currentWindowWidth);
-                    if (m_finishLine) m_finishLine->Draw();
-                    
-                    for (const auto& enemy : m_enemies) {
-                        if (enemy) {
-                            enemy->Draw(TEXTURE_RESOLUTION, m_currentWindowHeight, m_currentWindowWidth);
-                        }
-                    }
-
-                    m_explosionManager.Draw();
-                    
-                    EndMode2D();
-
-                    // Draw UI
-                    if (m_player) {
-                        const std::string playerKills = "Kills: " + std::to_string(m_player->GetKillCount());
-                        int killsFontSize = 40;
-                        const int killsWidth = MeasureText(playerKills.c_str(), killsFontSize);
-                        killsFontSize = (killsWidth > m_currentWindowWidth/3) ? 
-                                       (killsFontSize * (m_currentWindowWidth/3) / killsWidth) : killsFontSize;
-                        DrawText(playerKills.c_str(), 20, 20, killsFontSize, MAROON);
-                    }
-
-                    if (m_currentGameState == GameState::GameOver) {
-                        DrawGameOverMenu();
-                    }
-                    break;
-                case GameState::Exit:
-                    break;
-            }
 
-            EndDrawing();
-        }
+        m_gpuTimer.EndFrame(); // Before the capture, whose readback isn't part of the frame
+        m_frameCapture.CaptureFrame();
+        renderSeconds = GetTime() - renderStartTime;
+        EndDrawing();
+        m_renderTimeHistograms[static_cast<std::size_t>(m_currentGameState)].RecordSeconds(renderSeconds);
     }
+    
+    RecordFlightFrame(tickState, updateSeconds, renderSeconds);
 }
 
 } // namespace PlayAsGobo
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "GhostRun.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+namespace PlayAsGobo {
+
+namespace {
+
+std::uint32_t ZigZagEncode(std::int32_t value) noexcept {
+    return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+}
+
+std::int32_t ZigZagDecode(std::uint32_t value) noexcept {
+    return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1u);
+}
+
+} // namespace
+
+void GhostTrack::Clear() noexcept {
+    m_bytes.clear();
+    m_sampleCount = 0;
+    m_last = Quantised{};
+}
+
+void GhostTrack::Append(const GhostPose& pose) {
+    const Quantised sample = Quantise(pose);
+    const bool moved = sample.x != m_last.x || sample.y != m_last.y;
+    const bool scaled = sample.scale != m_last.scale;
+
+    std::uint8_t control = sample.frame & FRAME_MASK;
+    if (moved) control |= FLAG_MOVED;
+    if (scaled) control |= FLAG_SCALED;
+    m_bytes.push_back(control);
+
+    if (moved) {
+        WriteVarint(sample.x - m_last.x);
+        WriteVarint(sample.y - m_last.y);
+    }
+    if (scaled) {
+        WriteVarint(sample.scale - m_last.scale);
+    }
+
+    m_last = sample;
+    ++m_sampleCount;
+}
+
+float GhostTrack::GetDuration() const noexcept {
+    return m_sampleCount > 1 ? static_cast<float>(m_sampleCount - 1) * SAMPLE_INTERVAL : 0.0f;
+}
+
+void GhostTrack::Assign(std::vector<std::uint8_t> bytes, std::uint32_t sampleCount) {
+    m_bytes = std::move(bytes);
+    m_sampleCount = sampleCount;
+    m_last = Quantised{}; // Only used for appending, which loaded tracks never do
+}
+
+GhostTrack::Quantised GhostTrack::Quantise(const GhostPose& pose) noexcept {
+    Quantised sample;
+    sample.x = static_cast<std::int32_t>(std::lround(pose.position.x * POSITION_STEPS));
+    sample.y = static_cast<std::int32_t>(std::lround(pose.position.y * POSITION_STEPS));
+    sample.scale = static_cast<std::int32_t>(std::lround(pose.sizeScale * SCALE_STEPS));
+    sample.frame = pose.frame & FRAME_MASK;
+    return sample;
+}
+
+void GhostTrack::WriteVarint(std::int32_t value) {
+    std::uint32_t bits = ZigZagEncode(value);
+    while (bits >= 0x80u) {
+        m_bytes.push_back(static_cast<std::uint8_t>(bits | 0x80u));
+        bits >>= 7;
+    }
+    m_bytes.push_back(static_cast<std::uint8_t>(bits));
+}
+
+void GhostRecorder::Start() noexcept {
+    m_track.Clear();
+    m_time = 0.0f;
+    m_isRecording = true;
+}
+
+void GhostRecorder::Update(float deltaTime, const GhostPose& pose) {
+    if (!m_isRecording) return;
+
+    // A long frame repeats the pose, so sample N always belongs to N * SAMPLE_INTERVAL
+    while (static_cast<float>(m_track.GetSampleCount()) * GhostTrack::SAMPLE_INTERVAL <= m_time) {
+        m_track.Append(pose);
+    }
+    m_time += deltaTime;
+}
+
+GhostCursor::GhostCursor(const GhostTrack& track) noexcept
+    : m_track(&track) {
+    m_isFinished = track.GetSampleCount() < 2 || !DecodeNext(m_current) || !DecodeNext(m_next);
+}
+
+bool GhostCursor::Seek(float time) noexcept {
+    if (m_isFinished) return false;
+
+    const float position = std::max(time, 0.0f) / GhostTrack::SAMPLE_INTERVAL;
+    if (position >= static_cast<float>(m_track->GetSampleCount() - 1)) {
+        m_isFinished = true;
+        return false;
+    }
+
+    const std::uint32_t index = static_cast<std::uint32_t>(position);
+    while (m_index < index) {
+        m_current = m_next;
+        ++m_index;
+        if (!DecodeNext(m_next)) {
+            m_isFinished = true;
+            return false;
+        }
+    }
+    m_fraction = position - static_cast<float>(index);
+    return true;
+}
+
+GhostPose GhostCursor::GetPose() const noexcept {
+    auto lerp = [this](std::int32_t from, std::int32_t to) {
+        return static_cast<float>(from) + static_cast<float>(to - from) * m_fraction;
+    };
+
+    GhostPose pose;
+    pose.position.x = lerp(m_current.x, m_next.x) / GhostTrack::POSITION_STEPS;
+    pose.position.y = lerp(m_current.y, m_next.y) / GhostTrack::POSITION_STEPS;
+    pose.sizeScale = lerp(m_current.scale, m_next.scale) / GhostTrack::SCALE_STEPS;
+    pose.frame = m_current.frame;
+    return pose;
+}
+
+bool GhostCursor::DecodeNext(GhostTrack::Quantised& sample) noexcept {
+    const std::vector<std::uint8_t>& bytes = m_track->GetBytes();
+    if (m_offset >= bytes.size()) return false;
+
+    const std::uint8_t control = bytes[m_offset++];
+
+    // Deltas apply to the newest sample decoded so far
+    GhostTrack::Quantised decoded = m_decoded;
+    decoded.frame = control & GhostTrack::FRAME_MASK;
+
+    std::int32_t delta = 0;
+    if (control & GhostTrack::FLAG_MOVED) {
+        if (!ReadVarint(delta)) return false;
+        decoded.x += delta;
+        if (!ReadVarint(delta)) return false;
+        decoded.y += delta;
+    }
+    if (control & GhostTrack::FLAG_SCALED) {
+        if (!ReadVarint(delta)) return false;
+        decoded.scale += delta;
+    }
+
+    m_decoded = decoded;
+    sample = decoded;
+    return true;
+}
+
+bool GhostCursor::ReadVarint(std::int32_t& value) noexcept {
+    const std::vector<std::uint8_t>& bytes = m_track->GetBytes();
+    std::uint32_t bits = 0;
+    for (std::uint32_t shift = 0; shift < 35; shift += 7) {
+        if (m_offset >= bytes.size()) return false;
+        const std::uint8_t byte = bytes[m_offset++];
+        bits |= static_cast<std::uint32_t>(byte & 0x7Fu) << shift;
+        if ((byte & 0x80u) == 0) {
+            value = ZigZagDecode(bits);
+            return true;
+        }
+    }
+    return false; // Longer than any 32-bit value, so the track is damaged
+}
+
+bool GhostLibrary::Load(const std::string& path) {
+    m_runs.clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    Header header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != MAGIC || header.version != FILE_VERSION) {
+        std::cerr << "Warning: Ignoring unreadable ghost file " << path << std::endl;
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < header.runCount && m_runs.size() < MAX_RUNS; ++i) {
+        RunHeader runHeader;
+        file.read(reinterpret_cast<char*>(&runHeader), sizeof(runHeader));
+        if (!file || runHeader.byteCount > MAX_TRACK_BYTES) {
+            std::cerr << "Warning: Ghost file " << path << " is damaged, keeping " << m_runs.size()
+                      << " runs" << std::endl;
+            break;
+        }
+
+        std::vector<std::uint8_t> bytes(runHeader.byteCount);
+        file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file) {
+            std::cerr << "Warning: Ghost file " << path << " is truncated, keeping " << m_runs.size()
+                      << " runs" << std::endl;
+            break;
+        }
+
+        GhostRun run;
+        run.killCount = runHeader.killCount;
+        run.track.Assign(std::move(bytes), runHeader.sampleCount);
+        m_runs.push_back(std::move(run));
+    }
+
+    std::stable_sort(m_runs.begin(), m_runs.end(), IsBetter);
+    return true;
+}
+
+bool GhostLibrary::Save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Warning: Could not write ghost file " << path << std::endl;
+        return false;
+    }
+
+    Header header;
+    header.magic = MAGIC;
+    header.version = FILE_VERSION;
+    header.runCount = static_cast<std::uint32_t>(m_runs.size());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const GhostRun& run : m_runs) {
+        const std::vector<std::uint8_t>& bytes = run.track.GetBytes();
+        RunHeader runHeader;
+        runHeader.killCount = run.killCount;
+        runHeader.sampleCount = run.track.GetSampleCount();
+        runHeader.byteCount = static_cast<std::uint32_t>(bytes.size());
+        file.write(reinterpret_cast<const char*>(&runHeader), sizeof(runHeader));
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    return static_cast<bool>(file);
+}
+
+std::size_t GhostLibrary::Submit(GhostRun run) {
+    if (run.track.GetSampleCount() < 2) return MAX_RUNS;
+
+    // Ties go to the run that was there first
+    const auto position = std::upper_bound(m_runs.begin(), m_runs.end(), run, IsBetter);
+    const std::size_t rank = static_cast<std::size_t>(position - m_runs.begin());
+    if (rank >= MAX_RUNS) return MAX_RUNS;
+
+    m_runs.insert(position, std::move(run));
+    if (m_runs.size() > MAX_RUNS) {
+        m_runs.pop_back();
+    }
+    return rank;
+}
+
+bool GhostLibrary::IsBetter(const GhostRun& first, const GhostRun& second) noexcept {
+    if (first.killCount != second.killCount) return first.killCount > second.killCount;
+    return first.track.GetSampleCount() > second.track.GetSampleCount();
+}
+
+} // namespace PlayAsGobo
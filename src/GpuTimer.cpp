@@ -0,0 +1,166 @@
+#include "GpuTimer.hpp"
+#include "raylib.h"
+#include "rlgl.h"
+
+// The vendored raylib exposes its glad loader; a system raylib may not ship it
+#if __has_include("external/glad.h")
+    #include "external/glad.h"
+    #define PLAYASGOBO_HAS_GL_QUERIES 1
+#endif
+
+namespace PlayAsGobo {
+
+GpuTimer::~GpuTimer() {
+    Stop();
+}
+
+bool GpuTimer::Start() {
+    Stop();
+
+#if defined(PLAYASGOBO_HAS_GL_QUERIES)
+    // Timestamps are core from 3.3; a 2.1 context needs the extension
+    const int version = rlGetVersion();
+    const bool hasTimerQueries = version == RL_OPENGL_33 || version == RL_OPENGL_43 ||
+                                 (version == RL_OPENGL_21 && GLAD_GL_ARB_timer_query);
+    if (!hasTimerQueries || glad_glGenQueries == nullptr || glad_glQueryCounter == nullptr ||
+        glad_glGetQueryObjectiv == nullptr || glad_glGetQueryObjectui64v == nullptr) {
+        return false;
+    }
+
+    for (FrameSlot& slot : m_slots) {
+        glGenQueries(static_cast<GLsizei>(slot.queries.size()), slot.queries.data());
+        slot.markCount = 0;
+        slot.isPending = false;
+    }
+    m_currentSlot = 0;
+    m_isInFrame = false;
+    m_isRunning = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void GpuTimer::Stop() noexcept {
+    if (!m_isRunning) return;
+
+#if defined(PLAYASGOBO_HAS_GL_QUERIES)
+    if (IsWindowReady()) {
+        for (FrameSlot& slot : m_slots) {
+            glDeleteQueries(static_cast<GLsizei>(slot.queries.size()), slot.queries.data());
+        }
+    }
+#endif
+    m_slots = {};
+    m_isInFrame = false;
+    m_isRunning = false;
+}
+
+void GpuTimer::BeginFrame() {
+    if (!m_isRunning) return;
+
+    CollectAvailable();
+
+    // Still not finished after FRAME_LATENCY frames; waiting for it would stall the frame
+    FrameSlot& slot = m_slots[m_currentSlot];
+    if (slot.isPending) {
+        slot.isPending = false;
+        ++m_droppedFrames;
+    }
+    slot.markCount = 0;
+    m_isInFrame = true;
+}
+
+void GpuTimer::BeginPass(GpuPass pass) {
+    if (!m_isInFrame) return;
+
+    // The last mark is kept for EndFrame(); past that the current pass just runs on
+    const FrameSlot& slot = m_slots[m_currentSlot];
+    if (slot.markCount >= MAX_MARKS_PER_FRAME - 1) return;
+    if (slot.markCount > 0 && slot.passes[slot.markCount - 1] == pass) return;
+    Mark(pass);
+}
+
+void GpuTimer::EndFrame() {
+    if (!m_isInFrame) return;
+    m_isInFrame = false;
+
+    FrameSlot& slot = m_slots[m_currentSlot];
+    if (slot.markCount == 0) return;
+
+    Mark(GpuPass::Count);
+    slot.isPending = true;
+    m_currentSlot = (m_currentSlot + 1) % FRAME_LATENCY;
+}
+
+const char* GpuTimer::GetPassName(GpuPass pass) noexcept {
+    switch (pass) {
+        case GpuPass::Lights:    return "Lights";
+        case GpuPass::Ground:    return "Ground";
+        case GpuPass::Sprites:   return "Sprites";
+        case GpuPass::Particles: return "Particles";
+        case GpuPass::Composite: return "Composite";
+        case GpuPass::Ui:        return "Ui";
+        case GpuPass::Count:     break;
+    }
+    return "Unknown";
+}
+
+void GpuTimer::Mark(GpuPass pass) {
+    FrameSlot& slot = m_slots[m_currentSlot];
+
+    // Anything still batched belongs to the pass that is ending
+    rlDrawRenderBatchActive();
+#if defined(PLAYASGOBO_HAS_GL_QUERIES)
+    glQueryCounter(slot.queries[slot.markCount], GL_TIMESTAMP);
+#endif
+    slot.passes[slot.markCount] = pass;
+    ++slot.markCount;
+}
+
+bool GpuTimer::TryCollect(FrameSlot& slot) {
+#if defined(PLAYASGOBO_HAS_GL_QUERIES)
+    // Queries complete in order, so the frame's last one decides for all of them
+    GLint isAvailable = 0;
+    glGetQueryObjectiv(slot.queries[slot.markCount - 1], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+    if (!isAvailable) return false;
+
+    std::array<GLuint64, MAX_MARKS_PER_FRAME> timestamps{};
+    for (std::size_t i = 0; i < slot.markCount; ++i) {
+        glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+
+    // A pass may run several times in a frame; each gets one sample per frame
+    std::array<std::uint64_t, GPU_PASS_COUNT> passNanoseconds{};
+    std::array<bool, GPU_PASS_COUNT> wasDrawn{};
+    for (std::size_t i = 0; i + 1 < slot.markCount; ++i) {
+        const std::size_t pass = static_cast<std::size_t>(slot.passes[i]);
+        if (timestamps[i + 1] > timestamps[i]) {
+            passNanoseconds[pass] += timestamps[i + 1] - timestamps[i];
+        }
+        wasDrawn[pass] = true;
+    }
+    for (std::size_t pass = 0; pass < GPU_PASS_COUNT; ++pass) {
+        if (wasDrawn[pass]) {
+            m_passHistograms[pass].RecordMicroseconds(passNanoseconds[pass] / 1000);
+        }
+    }
+
+    const GLuint64 first = timestamps[0];
+    const GLuint64 last = timestamps[slot.markCount - 1];
+    m_frameHistogram.RecordMicroseconds(last > first ? (last - first) / 1000 : 0);
+#endif
+    slot.isPending = false;
+    return true;
+}
+
+void GpuTimer::CollectAvailable() {
+    // The current slot is the oldest; stop at the first frame the GPU hasn't finished
+    for (std::size_t i = 0; i < FRAME_LATENCY; ++i) {
+        FrameSlot& slot = m_slots[(m_currentSlot + i) % FRAME_LATENCY];
+        if (!slot.isPending) continue;
+        if (!TryCollect(slot)) break;
+    }
+}
+
+} // namespace PlayAsGobo
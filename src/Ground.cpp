@@ -1,5 +1,6 @@
 #include "Ground.hpp"
 #include "Entity.hpp" // For Circle definition
+#include "TerrainMask.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <iostream>
@@ -103,6 +104,10 @@ Vector2 Ground::GetCenter() const noexcept {
     };
 }
 
+bool Ground::HasReadyTerrain() const noexcept {
+    return m_terrainMask && m_terrainMask->IsReady();
+}
+
 // Setters
 void Ground::SetPosition(float x, float y) {
     m_bounds.x = x;
@@ -153,6 +158,12 @@ void Ground::Move(Vector2 delta) noexcept {
     m_bounds.y += delta.y;
 }
 
+void Ground::MoveTo(Vector2 position) noexcept {
+    m_displacement = {position.x - m_bounds.x, position.y - m_bounds.y};
+    m_bounds.x = position.x;
+    m_bounds.y = position.y;
+}
+
 void Ground::Scale(float factor) {
     if (factor <= 0.0f) {
         throw std::invalid_argument("Scale factor must be positive");
@@ -268,10 +279,10 @@ Rectangle Ground::CalculateClippedSourceRect(const Rectangle& sourceRect,
     return clippedSource;
 }
 
-void Ground::DrawTile(float textureWidth, float textureHeight,
-                     std::int32_t tileX, std::int32_t tileY) const {
-    const Rectangle sourceRect = {0.0f, 0.0f, textureWidth, textureHeight};
-    const Rectangle destRect = {
+bool Ground::ComputeTile(float textureWidth, float textureHeight, std::int32_t tileX, std::int32_t tileY,
+                         Rectangle& destRect, Rectangle& sourceRect) const noexcept {
+    const Rectangle fullSourceRect = {0.0f, 0.0f, textureWidth, textureHeight};
+    const Rectangle fullDestRect = {
         m_bounds.x + tileX * textureWidth,
         m_bounds.y + tileY * textureHeight,
         textureWidth,
@@ -279,17 +290,45 @@ void Ground::DrawTile(float textureWidth, float textureHeight,
     };
     
     // Clip destination rectangle to ground bounds
-    const Rectangle clippedDestRect = CalculateClippedDestRect(destRect);
+    destRect = CalculateClippedDestRect(fullDestRect);
     
     // Skip if tile is completely outside bounds
-    if (clippedDestRect.width <= 0.0f || clippedDestRect.height <= 0.0f) {
-        return;
+    if (destRect.width <= 0.0f || destRect.height <= 0.0f) {
+        return false;
     }
     
     // Calculate corresponding source rectangle for clipped destination
-    const Rectangle clippedSourceRect = CalculateClippedSourceRect(sourceRect, destRect, clippedDestRect);
+    sourceRect = CalculateClippedSourceRect(fullSourceRect, fullDestRect, destRect);
+    return true;
+}
+
+void Ground::DrawTile(float textureWidth, float textureHeight,
+                      std::int32_t tileX, std::int32_t tileY) const {
+    Rectangle destRect;
+    Rectangle sourceRect;
+    if (ComputeTile(textureWidth, textureHeight, tileX, tileY, destRect, sourceRect)) {
+        DrawTexturePro(m_texture, sourceRect, destRect, Vector2{0.0f, 0.0f}, 0.0f, m_tintColor);
+    }
+}
+
+void Ground::CollectTiles(std::vector<StaticTile>& tiles) const {
+    if (!m_hasTexture || m_texture.width <= 0 || m_texture.height <= 0) return;
+    
+    const float textureWidth = static_cast<float>(m_texture.width);
+    const float textureHeight = static_cast<float>(m_texture.height);
+    
+    std::int32_t tilesX, tilesY;
+    CalculateTileLayout(textureWidth, textureHeight, tilesX, tilesY);
     
-    DrawTexturePro(m_texture, clippedSourceRect, clippedDestRect, Vector2{0.0f, 0.0f}, 0.0f, m_tintColor);
+    for (std::int32_t x = 0; x < tilesX; ++x) {
+        for (std::int32_t y = 0; y < tilesY; ++y) {
+            StaticTile tile{};
+            if (ComputeTile(textureWidth, textureHeight, x, y, tile.destination, tile.source)) {
+                tile.tint = m_tintColor;
+                tiles.push_back(tile);
+            }
+        }
+    }
 }
 
 void Ground::DrawTexturedGround() const {
@@ -324,7 +363,9 @@ void Ground::DrawSolidGround() const {
 
 // Main rendering methods
 void Ground::Draw() const {
-    if (m_hasTexture) {
+    if (HasReadyTerrain()) {
+        m_terrainMask->Draw(m_hasTexture ? m_tintColor : WHITE);
+    } else if (m_hasTexture) {
         DrawTexturedGround();
     } else {
         DrawSolidGround();
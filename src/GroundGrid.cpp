@@ -0,0 +1,82 @@
+#include "GroundGrid.hpp"
+#include <cmath>
+
+namespace PlayAsGobo {
+
+void GroundGrid::Reset(const Rectangle& area, float cellSize) {
+    m_proxies.clear();
+    m_cells.clear();
+    m_cellChangeCount = 0;
+    if (area.width <= 0.0f || area.height <= 0.0f || cellSize <= 0.0f) {
+        m_columns = 0;
+        m_rows = 0;
+        return;
+    }
+
+    m_area = area;
+    m_inverseCellSize = 1.0f / cellSize;
+    m_columns = std::max(1, static_cast<std::int32_t>(std::ceil(area.width * m_inverseCellSize)));
+    m_rows = std::max(1, static_cast<std::int32_t>(std::ceil(area.height * m_inverseCellSize)));
+    m_cells.resize(static_cast<std::size_t>(m_columns) * static_cast<std::size_t>(m_rows));
+}
+
+GroundGrid::Proxy GroundGrid::Insert(Ground* ground) {
+    const Proxy proxy = static_cast<Proxy>(m_proxies.size());
+    ProxyData data;
+    data.ground = ground;
+    if (ground && !m_cells.empty()) {
+        data.cells = GetCellRange(ground->GetBounds());
+    }
+    m_proxies.push_back(data);
+    AddToCells(proxy, data.cells);
+    return proxy;
+}
+
+bool GroundGrid::Refit(Proxy proxy) {
+    ProxyData& data = m_proxies[proxy];
+    if (!data.ground || m_cells.empty()) return false;
+
+    const CellRange cells = GetCellRange(data.ground->GetBounds());
+    if (cells == data.cells) return false;
+
+    RemoveFromCells(proxy, data.cells);
+    AddToCells(proxy, cells);
+    data.cells = cells;
+    ++m_cellChangeCount;
+    return true;
+}
+
+GroundGrid::CellRange GroundGrid::GetCellRange(const Rectangle& bounds) const noexcept {
+    return {GetColumn(bounds.x), GetRow(bounds.y),
+            GetColumn(bounds.x + bounds.width), GetRow(bounds.y + bounds.height)};
+}
+
+std::int32_t GroundGrid::GetColumn(float x) const noexcept {
+    const float column = std::floor((x - m_area.x) * m_inverseCellSize);
+    return static_cast<std::int32_t>(std::clamp(column, 0.0f, static_cast<float>(m_columns - 1)));
+}
+
+std::int32_t GroundGrid::GetRow(float y) const noexcept {
+    const float row = std::floor((y - m_area.y) * m_inverseCellSize);
+    return static_cast<std::int32_t>(std::clamp(row, 0.0f, static_cast<float>(m_rows - 1)));
+}
+
+void GroundGrid::AddToCells(Proxy proxy, const CellRange& cells) {
+    for (std::int32_t row = cells.firstY; row <= cells.lastY; ++row) {
+        for (std::int32_t column = cells.firstX; column <= cells.lastX; ++column) {
+            m_cells[static_cast<std::size_t>(row * m_columns + column)].push_back(proxy);
+        }
+    }
+}
+
+void GroundGrid::RemoveFromCells(Proxy proxy, const CellRange& cells) noexcept {
+    for (std::int32_t row = cells.firstY; row <= cells.lastY; ++row) {
+        for (std::int32_t column = cells.firstX; column <= cells.lastX; ++column) {
+            std::vector<Proxy>& cell = m_cells[static_cast<std::size_t>(row * m_columns + column)];
+            // Order-preserving, so replays visit grounds in the same order
+            cell.erase(std::remove(cell.begin(), cell.end(), proxy), cell.end());
+        }
+    }
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,25 @@
+#include "InputFrame.hpp"
+#include "raylib.h"
+
+namespace PlayAsGobo {
+
+InputFrame InputFrame::Sample() noexcept {
+    InputFrame input;
+
+    auto setButton = [&input](InputButton button, bool isDown, bool wasPressed) {
+        if (isDown) input.held |= static_cast<std::uint8_t>(button);
+        if (wasPressed) input.pressed |= static_cast<std::uint8_t>(button);
+    };
+
+    setButton(InputButton::MoveLeft, IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A),
+              IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A));
+    setButton(InputButton::MoveRight, IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D),
+              IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D));
+    setButton(InputButton::Bomb, IsKeyDown(KEY_SPACE), IsKeyPressed(KEY_SPACE));
+    setButton(InputButton::Shoot, IsKeyDown(KEY_F), IsKeyPressed(KEY_F));
+    setButton(InputButton::Back, IsKeyDown(KEY_ESCAPE), IsKeyPressed(KEY_ESCAPE));
+
+    return input;
+}
+
+} // namespace PlayAsGobo
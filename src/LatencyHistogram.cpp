@@ -0,0 +1,124 @@
+#include "LatencyHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace PlayAsGobo {
+
+LatencyHistogram::LatencyHistogram()
+    : m_counts(GetBucketIndex(MAX_TRACKABLE_MICROSECONDS) + 1, 0) {
+}
+
+std::uint32_t LatencyHistogram::GetMostSignificantBit(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<std::uint32_t>(__builtin_clzll(value));
+#else
+    std::uint32_t bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+std::size_t LatencyHistogram::GetBucketIndex(std::uint64_t value) noexcept {
+    if (value < LINEAR_BUCKET_COUNT) {
+        return static_cast<std::size_t>(value);
+    }
+
+    // Keep the top SUB_BUCKET_BITS bits (leading one included) as the sub-bucket
+    const std::uint32_t shift = GetMostSignificantBit(value) - (SUB_BUCKET_BITS - 1);
+    const std::uint64_t mantissa = value >> shift;
+
+    return static_cast<std::size_t>(LINEAR_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF +
+                                    (mantissa - SUB_BUCKET_HALF));
+}
+
+std::uint64_t LatencyHistogram::GetBucketUpperBound(std::size_t index) noexcept {
+    if (index < LINEAR_BUCKET_COUNT) {
+        return index;
+    }
+
+    const std::uint64_t offset = index - LINEAR_BUCKET_COUNT;
+    const std::uint64_t shift = offset / SUB_BUCKET_HALF + 1;
+    const std::uint64_t mantissa = SUB_BUCKET_HALF + offset % SUB_BUCKET_HALF;
+
+    return (mantissa << shift) + ((1ull << shift) - 1);
+}
+
+void LatencyHistogram::RecordSeconds(double seconds) noexcept {
+    if (!(seconds > 0.0)) {
+        RecordMicroseconds(0);
+        return;
+    }
+
+    const double microseconds = std::min(seconds * 1.0e6, static_cast<double>(MAX_TRACKABLE_MICROSECONDS));
+    RecordMicroseconds(static_cast<std::uint64_t>(std::llround(microseconds)));
+}
+
+void LatencyHistogram::RecordMicroseconds(std::uint64_t microseconds) noexcept {
+    const std::uint64_t value = std::min(microseconds, MAX_TRACKABLE_MICROSECONDS);
+
+    ++m_counts[GetBucketIndex(value)];
+    m_minValue = (m_totalCount == 0) ? value : std::min(m_minValue, value);
+    m_maxValue = std::max(m_maxValue, value);
+    m_sum += static_cast<double>(value);
+    ++m_totalCount;
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) noexcept {
+    if (other.m_totalCount == 0) return;
+
+    for (std::size_t i = 0; i < m_counts.size(); ++i) {
+        m_counts[i] += other.m_counts[i];
+    }
+
+    m_minValue = (m_totalCount == 0) ? other.m_minValue : std::min(m_minValue, other.m_minValue);
+    m_maxValue = std::max(m_maxValue, other.m_maxValue);
+    m_sum += other.m_sum;
+    m_totalCount += other.m_totalCount;
+}
+
+void LatencyHistogram::Reset() noexcept {
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_totalCount = 0;
+    m_minValue = 0;
+    m_maxValue = 0;
+    m_sum = 0.0;
+}
+
+std::uint64_t LatencyHistogram::GetMinMicroseconds() const noexcept {
+    return m_minValue;
+}
+
+double LatencyHistogram::GetMeanMicroseconds() const noexcept {
+    return (m_totalCount == 0) ? 0.0 : m_sum / static_cast<double>(m_totalCount);
+}
+
+std::uint64_t LatencyHistogram::GetPercentileMicroseconds(double percentile) const {
+    if (percentile < 0.0 || percentile > 100.0) {
+        throw std::invalid_argument("Histogram percentile must be between 0 and 100, got " +
+                                  std::to_string(percentile));
+    }
+
+    if (m_totalCount == 0) {
+        return 0;
+    }
+
+    // Rank of the sample at this percentile (1-based, nearest-rank method)
+    const double exactRank = std::ceil(percentile / 100.0 * static_cast<double>(m_totalCount));
+    const std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(exactRank));
+
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < m_counts.size(); ++i) {
+        cumulative += m_counts[i];
+        if (cumulative >= rank) {
+            return std::min(GetBucketUpperBound(i), m_maxValue);
+        }
+    }
+
+    return m_maxValue;
+}
+
+} // namespace PlayAsGobo
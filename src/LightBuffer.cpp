@@ -0,0 +1,143 @@
+#include "LightBuffer.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+
+namespace PlayAsGobo {
+
+namespace {
+
+// Plain additive blending: the buffer holds light, so neither side is scaled by alpha
+void BeginAdditiveBlend() {
+    rlSetBlendFactors(RL_ONE, RL_ONE, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM);
+}
+
+} // namespace
+
+LightBuffer::~LightBuffer() {
+    Unload();
+}
+
+bool LightBuffer::Resize(int screenWidth, int screenHeight) {
+    if (screenWidth <= 0 || screenHeight <= 0) {
+        return IsReady(); // Minimised; keep the old targets until the window comes back
+    }
+    if (IsReady() && screenWidth == m_screenWidth && screenHeight == m_screenHeight) {
+        return true;
+    }
+    Unload();
+
+    const int width = std::max(1, screenWidth / DOWNSCALE);
+    const int height = std::max(1, screenHeight / DOWNSCALE);
+    for (RenderTexture2D& target : m_targets) {
+        target = LoadRenderTexture(width, height);
+        if (target.id == 0) {
+            Unload();
+            return false;
+        }
+        // Bilinear taps do the blurring and the upscale; clamping keeps edges from wrapping
+        SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
+        SetTextureWrap(target.texture, TEXTURE_WRAP_CLAMP);
+    }
+
+    Image image = GenImageGradientRadial(SPRITE_SIZE, SPRITE_SIZE, 0.0f, WHITE, BLANK);
+    if (image.data) {
+        m_sprite = LoadTextureFromImage(image);
+        UnloadImage(image);
+        SetTextureFilter(m_sprite, TEXTURE_FILTER_BILINEAR);
+    }
+
+    m_screenWidth = screenWidth;
+    m_screenHeight = screenHeight;
+    return true;
+}
+
+void LightBuffer::Unload() noexcept {
+    for (RenderTexture2D& target : m_targets) {
+        if (target.id != 0) UnloadRenderTexture(target);
+        target = RenderTexture2D{};
+    }
+    if (m_sprite.id != 0) UnloadTexture(m_sprite);
+    m_sprite = Texture2D{};
+    m_hasLights = false;
+}
+
+void LightBuffer::Begin(const Camera2D& camera) {
+    m_hasLights = false;
+    m_isAccumulating = IsReady();
+    if (!m_isAccumulating) return;
+
+    // Same view as the frame, scaled down to the buffer
+    const float scale = static_cast<float>(m_targets[0].texture.width) / static_cast<float>(m_screenWidth);
+    Camera2D scaled = camera;
+    scaled.offset = Vector2Scale(camera.offset, scale);
+    scaled.zoom = camera.zoom * scale;
+
+    BeginTextureMode(m_targets[0]);
+    ClearBackground(BLANK);
+    BeginMode2D(scaled);
+    BeginAdditiveBlend();
+    rlSetTexture(m_sprite.id != 0 ? m_sprite.id : rlGetTextureIdDefault());
+    rlBegin(RL_QUADS);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    m_quads.Begin();
+}
+
+void LightBuffer::AddLight(Vector2 position, float radius, Color color) {
+    if (!m_isAccumulating || radius <= 0.0f || color.a == 0) return;
+    m_hasLights = true;
+
+    const float intensity = color.a / 255.0f;
+    m_quads.Add(position, radius,
+                {static_cast<unsigned char>(color.r * intensity), static_cast<unsigned char>(color.g * intensity),
+                 static_cast<unsigned char>(color.b * intensity), 255});
+}
+
+void LightBuffer::End() {
+    if (!m_isAccumulating) return;
+    m_isAccumulating = false;
+
+    m_quads.Finish();
+    rlEnd();
+    rlSetTexture(0);
+    EndBlendMode();
+    EndMode2D();
+    EndTextureMode();
+
+    if (!m_hasLights) return;
+    BlurPass(m_targets[0], m_targets[1], BLUR_OFFSETS[0]);
+    BlurPass(m_targets[1], m_targets[0], BLUR_OFFSETS[1]);
+}
+
+void LightBuffer::BlurPass(const RenderTexture2D& source, const RenderTexture2D& destination, float offset) const {
+    // Kawase pass: four bilinear taps on the diagonals, each a quarter of the result
+    const Rectangle sourceRect = {0.0f, 0.0f, static_cast<float>(source.texture.width),
+                                  -static_cast<float>(source.texture.height)};
+    constexpr Color QUARTER = {64, 64, 64, 64};
+    constexpr std::array<Vector2, 4> DIAGONALS = {{{-1.0f, -1.0f}, {1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}}};
+
+    BeginTextureMode(destination);
+    ClearBackground(BLANK);
+    BeginAdditiveBlend();
+    for (const Vector2 direction : DIAGONALS) {
+        DrawTextureRec(source.texture, sourceRect, Vector2Scale(direction, offset), QUARTER);
+    }
+    EndBlendMode();
+    EndTextureMode();
+}
+
+void LightBuffer::Composite() const {
+    if (!IsReady() || !m_hasLights) return;
+
+    const RenderTexture2D& lights = m_targets[0];
+    const Rectangle source = {0.0f, 0.0f, static_cast<float>(lights.texture.width),
+                              -static_cast<float>(lights.texture.height)};
+    const Rectangle destination = {0.0f, 0.0f, static_cast<float>(m_screenWidth),
+                                   static_cast<float>(m_screenHeight)};
+    BeginAdditiveBlend();
+    DrawTexturePro(lights.texture, source, destination, {0.0f, 0.0f}, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+} // namespace PlayAsGobo
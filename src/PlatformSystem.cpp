@@ -0,0 +1,96 @@
+#include "PlatformSystem.hpp"
+#include "raymath.h"
+#include <cmath>
+
+namespace PlayAsGobo {
+
+void PlatformSystem::Clear() noexcept {
+    m_platforms.clear();
+    m_time = 0.0f;
+}
+
+void PlatformSystem::Add(Ground* ground, const PlatformPath& path) {
+    if (!ground) return;
+
+    Platform platform;
+    platform.ground = ground;
+    platform.path = path;
+    m_platforms.push_back(platform);
+    SetPath(m_platforms.size() - 1, path);
+}
+
+void PlatformSystem::SetPath(std::size_t index, const PlatformPath& path) noexcept {
+    Platform& platform = m_platforms[index];
+    platform.path = path;
+    platform.ground->SetPosition(GetPosition(path));
+}
+
+void PlatformSystem::Register(GroundGrid& grid) {
+    for (Platform& platform : m_platforms) {
+        platform.proxy = grid.Insert(platform.ground);
+    }
+}
+
+void PlatformSystem::Update(float deltaTime, GroundGrid& grid) {
+    m_time += deltaTime;
+
+    for (Platform& platform : m_platforms) {
+        platform.ground->MoveTo(GetPosition(platform.path));
+
+        // Waiting platforms stay where they are in the grid
+        const Vector2 displacement = platform.ground->GetDisplacement();
+        if (displacement.x != 0.0f || displacement.y != 0.0f) {
+            grid.Refit(platform.proxy);
+        }
+    }
+}
+
+void PlatformSystem::Draw(const Rectangle& visibleArea) const {
+    for (const Platform& platform : m_platforms) {
+        if (CheckCollisionRecs(platform.ground->GetBounds(), visibleArea)) {
+            platform.ground->Draw();
+        }
+    }
+}
+
+Vector2 PlatformSystem::GetPosition(const PlatformPath& path) const noexcept {
+    const float period = path.period > 0.0f ? path.period : 1.0f;
+    const float cycle = std::fmod(m_time / period + path.phase, 1.0f);
+    return Vector2Lerp(path.from, path.to, GetTravel(path.motion, cycle));
+}
+
+float PlatformSystem::GetTravel(PlatformMotion motion, float cycle) noexcept {
+    switch (motion) {
+        case PlatformMotion::Patrol:
+            return cycle < 0.5f ? cycle * 2.0f : (1.0f - cycle) * 2.0f;
+
+        case PlatformMotion::Elevator: {
+            // Wait, ease across, wait, ease back
+            const float moving = 0.5f - ELEVATOR_WAIT;
+            float travel = 0.0f;
+            if (cycle < ELEVATOR_WAIT) {
+                travel = 0.0f;
+            } else if (cycle < 0.5f) {
+                travel = (cycle - ELEVATOR_WAIT) / moving;
+            } else if (cycle < 0.5f + ELEVATOR_WAIT) {
+                travel = 1.0f;
+            } else {
+                travel = 1.0f - (cycle - 0.5f - ELEVATOR_WAIT) / moving;
+            }
+            return travel * travel * (3.0f - 2.0f * travel);
+        }
+
+        case PlatformMotion::Crusher:
+            if (cycle < CRUSHER_RAISED_END) return 0.0f;
+            if (cycle < CRUSHER_FALL_END) {
+                // Accelerates all the way down
+                const float fall = (cycle - CRUSHER_RAISED_END) / (CRUSHER_FALL_END - CRUSHER_RAISED_END);
+                return fall * fall;
+            }
+            if (cycle < CRUSHER_LOWERED_END) return 1.0f;
+            return 1.0f - (cycle - CRUSHER_LOWERED_END) / (1.0f - CRUSHER_LOWERED_END);
+    }
+    return 0.0f;
+}
+
+} // namespace PlayAsGobo
@@ -1,4 +1,5 @@
 #include "Player.hpp"
+#include "AudioCommands.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <iostream>
@@ -9,10 +10,11 @@ Player::Player(float x, float y, float radius,
                const std::vector<Texture2D>& playerTextures,
                const Music& walkSound, float scale, float speed)
     : Entity(x, y, radius * scale)
-    , m_textures(playerTextures)
+    , m_textures(&playerTextures)
     , m_walkSound(walkSound)
     , m_moveSpeed(speed)
     , m_originalRadius(radius)
+    , m_startScale(scale)
     , m_sizeScale(scale) {
     
     ValidateTextures();
@@ -21,17 +23,17 @@ Player::Player(float x, float y, float radius,
 }
 
 void Player::ValidateTextures() const {
-    if (m_textures.empty()) {
+    if (m_textures->empty()) {
         throw std::invalid_argument("Player textures cannot be empty");
     }
     
-    if (m_textures.size() < 3) {
+    if (m_textures->size() < 3) {
         throw std::invalid_argument("Player requires at least 3 texture frames");
     }
     
     // Validate that textures are actually loaded
-    for (std::size_t i = 0; i < m_textures.size(); ++i) {
-        if (m_textures[i].id == 0) {
+    for (std::size_t i = 0; i < m_textures->size(); ++i) {
+        if ((*m_textures)[i].id == 0) {
             throw std::invalid_argument("Player texture at index " + std::to_string(i) + 
                                       " is not properly loaded");
         }
@@ -101,6 +103,31 @@ void Player::ResetToOriginalSize() noexcept {
     UpdateRadius();
 }
 
+void Player::StopWalkSound() noexcept {
+    if (m_isWalkSoundPlaying) {
+        AudioCommands::StopMusic(m_walkSound);
+        m_isWalkSoundPlaying = false;
+    }
+}
+
+void Player::Respawn(float x, float y) noexcept {
+    SetPosition(x, y);
+    m_velocityY = 0.0f;
+    m_isOnGround = false;
+    m_canPhase = false;
+    
+    m_sizeScale = m_startScale;
+    m_animationTimer = 0.0f;
+    m_shotCooldown = 0.0f;
+    m_killCount = 0;
+    m_currentFrame = AnimationFrame::Standing;
+    m_isMoving = false;
+    m_isFacingLeft = false;
+    m_canUseBomb = false;
+    
+    UpdateRadius();
+}
+
 void Player::UpdateRadius() noexcept {
     const float newRadius = m_originalRadius * m_sizeScale;
     try {
@@ -111,23 +138,25 @@ void Player::UpdateRadius() noexcept {
     }
 }
 
-void Player::HandleInput(float deltaTime, const Rectangle& groundBounds,
-                        ExplosionManager& explosionManager,
+void Player::HandleInput(const InputFrame& input, float deltaTime, const Rectangle& groundBounds,
+                        ExplosionManager& explosionManager, ProjectileSystem& projectiles,
                         const Sound& explosionSound, bool soundEnabled) {
     if (deltaTime <= 0.0f) return;
     
-    UpdateMusicStream(m_walkSound);
-    
     // Handle movement input
-    HandleMovementInput(deltaTime, groundBounds, soundEnabled);
+    HandleMovementInput(input, deltaTime, groundBounds, soundEnabled);
     
     // Handle bomb input
-    HandleBombInput(explosionManager, explosionSound, soundEnabled);
+    HandleBombInput(input, explosionManager, explosionSound, soundEnabled);
+    
+    // Handle shooting (the free, short-range alternative to the bomb)
+    HandleShootInput(input, deltaTime, projectiles);
 }
 
-void Player::HandleMovementInput(float deltaTime, const Rectangle& groundBounds, bool soundEnabled) {
-    const bool movingRight = (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D));
-    const bool movingLeft = (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A));
+void Player::HandleMovementInput(const InputFrame& input, float deltaTime,
+                                 const Rectangle& groundBounds, bool soundEnabled) {
+    const bool movingRight = input.IsDown(InputButton::MoveRight);
+    const bool movingLeft = input.IsDown(InputButton::MoveLeft);
     
     m_isMoving = false;
     
@@ -139,19 +168,25 @@ void Player::HandleMovementInput(float deltaTime, const Rectangle& groundBounds,
         m_isMoving = true;
     }
     
-    // Handle walk sound
+    // Shots go the way Gobo last pressed, even when blocked at the edge
+    if (movingRight != movingLeft) {
+        m_isFacingLeft = movingLeft;
+    }
+    
+    // Handle walk sound; tracked here so the audio thread is never asked
     if (m_isMoving && m_isOnGround && soundEnabled) {
-        if (!IsMusicStreamPlaying(m_walkSound)) {
-            PlayMusicStream(m_walkSound);
+        if (!m_isWalkSoundPlaying) {
+            AudioCommands::PlayMusic(m_walkSound);
+            m_isWalkSoundPlaying = true;
         }
-    } else if (IsMusicStreamPlaying(m_walkSound)) {
-        StopMusicStream(m_walkSound);
+    } else {
+        StopWalkSound();
     }
 }
 
-void Player::HandleBombInput(ExplosionManager& explosionManager, 
+void Player::HandleBombInput(const InputFrame& input, ExplosionManager& explosionManager, 
                            const Sound& explosionSound, bool soundEnabled) {
-    if (IsKeyPressed(KEY_SPACE) && m_canUseBomb) {
+    if (input.WasPressed(InputButton::Bomb) && m_canUseBomb) {
         // Create explosion at player's position
         const Vector2 explosionPosition = {GetX(), GetY() - GetRadius()};
         explosionManager.CreateExplosion(explosionPosition, explosionSound, soundEnabled);
@@ -172,6 +207,22 @@ void Player::HandleBombInput(ExplosionManager& explosionManager,
     }
 }
 
+void Player::HandleShootInput(const InputFrame& input, float deltaTime, ProjectileSystem& projectiles) noexcept {
+    m_shotCooldown = std::max(0.0f, m_shotCooldown - deltaTime);
+    
+    // Held down fires repeatedly at the cooldown rate
+    if (!input.IsDown(InputButton::Shoot) || m_shotCooldown > 0.0f) {
+        return;
+    }
+    
+    const float direction = m_isFacingLeft ? -1.0f : 1.0f;
+    const Vector2 muzzle = {GetX() + direction * GetRadius(), GetY()};
+    if (projectiles.Spawn(ProjectileOwner::Player, muzzle, {direction * SHOT_SPEED, 0.0f},
+                          SHOT_RADIUS, SHOT_LIFETIME)) {
+        m_shotCooldown = SHOT_COOLDOWN;
+    }
+}
+
 void Player::UpdateAnimation(float deltaTime) {
     m_animationTimer += deltaTime;
     
@@ -199,13 +250,13 @@ void Player::Update(float deltaTime) {
 void Player::Draw(std::int32_t textureResolution, 
                 std::int32_t windowHeight, 
                 [[maybe_unused]] std::int32_t windowWidth) const {
-    if (m_textures.empty()) {
+    if (m_textures->empty()) {
         std::cerr << "Warning: No textures available for player rendering" << std::endl;
         return;
     }
     
     const std::size_t frameIndex = static_cast<std::size_t>(m_currentFrame);
-    if (frameIndex >= m_textures.size()) {
+    if (frameIndex >= m_textures->size()) {
         std::cerr << "Warning: Invalid frame index for player animation" << std::endl;
         return;
     }
@@ -227,7 +278,7 @@ void Player::Draw(std::int32_t textureResolution,
     };
     
     // Draw the player texture
-    DrawTexturePro(m_textures[frameIndex], sourceRect, destRect, 
+    DrawTexturePro((*m_textures)[frameIndex], sourceRect, destRect, 
                    Vector2{0.0f, 0.0f}, 0.0f, WHITE);
     
     // Draw bomb indicator if bomb is available
@@ -246,27 +297,24 @@ void Player::DrawBombIndicator(std::int32_t windowHeight) const {
     const std::int32_t textX = static_cast<std::int32_t>(GetX()) - textWidth / 2;
     const std::int32_t textY = windowHeight / 2 - TEXT_OFFSET_Y;
     
-    // Draw pulsing text
+    // Draw pulsing text; the matching glow goes through the light buffer (AddLights)
     DrawText(BOMB_TEXT, textX, textY, FONT_SIZE, MAROON);
+}
+
+void Player::AddLights(LightBuffer& lights) const {
+    if (!m_canUseBomb) return;
     
     // Calculate pulsing alpha for glow effect
     const float time = GetTime();
     const float alpha = (std::sin(time * BOMB_TEXT_PULSE_SPEED) + 1.0f) / 2.0f * BOMB_GLOW_OPACITY;
     
-    // Draw animated glow effect
+    // The buffer's blur softens the edge, so the light can be wider than the old gradient
     const Vector2 glowPosition = {
         GetX(), 
         GetY() - GetRadius() * 0.75f
     };
     
-    const float glowRadius = GetRadius() * 0.5f;
-    DrawCircleGradient(
-        static_cast<std::int32_t>(glowPosition.x),
-        static_cast<std::int32_t>(glowPosition.y),
-        static_cast<std::int32_t>(glowRadius),
-        Fade(RED, alpha),
-        BLANK
-    );
+    lights.AddLight(glowPosition, GetRadius() * BOMB_GLOW_RADIUS_SCALE, Fade(RED, alpha));
 }
 
 } // namespace PlayAsGobo
\ No newline at end of file
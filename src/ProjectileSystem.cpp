@@ -0,0 +1,190 @@
+#include "ProjectileSystem.hpp"
+#include "TerrainMask.hpp"
+#include "QuadWriter.hpp"
+#include "rlgl.h"
+#include <algorithm>
+
+namespace PlayAsGobo {
+
+ProjectileSystem::ProjectileSystem()
+    : m_x(CAPACITY)
+    , m_y(CAPACITY)
+    , m_velocityX(CAPACITY)
+    , m_velocityY(CAPACITY)
+    , m_radius(CAPACITY)
+    , m_life(CAPACITY)
+    , m_gravityScale(CAPACITY)
+    , m_owner(CAPACITY, ProjectileOwner::Player) {
+}
+
+ProjectileSystem::~ProjectileSystem() {
+    UnloadSprite();
+}
+
+void ProjectileSystem::LoadSprite() {
+    UnloadSprite();
+
+    // Soft-edged disc, tinted per owner at draw time
+    Image image = GenImageGradientRadial(SPRITE_SIZE, SPRITE_SIZE, 0.6f, WHITE, BLANK);
+    if (image.data) {
+        m_sprite = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+}
+
+void ProjectileSystem::UnloadSprite() noexcept {
+    if (m_sprite.id != 0) {
+        UnloadTexture(m_sprite);
+        m_sprite = Texture2D{};
+    }
+}
+
+bool ProjectileSystem::Spawn(ProjectileOwner owner, Vector2 position, Vector2 velocity,
+                             float radius, float lifetime, float gravityScale) noexcept {
+    if (m_count >= CAPACITY || lifetime <= 0.0f) {
+        return false;
+    }
+
+    const std::size_t index = m_count++;
+    m_x[index] = position.x;
+    m_y[index] = position.y;
+    m_velocityX[index] = velocity.x;
+    m_velocityY[index] = velocity.y;
+    m_radius[index] = radius;
+    m_life[index] = lifetime;
+    m_gravityScale[index] = gravityScale;
+    m_owner[index] = owner;
+    return true;
+}
+
+void ProjectileSystem::Integrate(float deltaTime, float gravity) noexcept {
+    if (deltaTime <= 0.0f) return;
+
+    // Plain loops over separate arrays, so the compiler can vectorise them
+    float* const x = m_x.data();
+    float* const y = m_y.data();
+    float* const velocityX = m_velocityX.data();
+    float* const velocityY = m_velocityY.data();
+    float* const life = m_life.data();
+    const float* const gravityScale = m_gravityScale.data();
+    const float gravityStep = gravity * deltaTime;
+
+    for (std::size_t i = 0; i < m_count; ++i) {
+        velocityY[i] += gravityScale[i] * gravityStep;
+        x[i] += velocityX[i] * deltaTime;
+        y[i] += velocityY[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+}
+
+void ProjectileSystem::CollideWithGround(const GroundGrid& grounds) noexcept {
+    for (std::size_t i = 0; i < m_count; ++i) {
+        // Projectiles are small, so their centre stands in for the whole disc
+        const Vector2 position = {m_x[i], m_y[i]};
+        grounds.QueryPoint(position, [&](const Ground* ground) {
+            if (!ground->CheckCollision(position)) return false;
+            if (ground->HasReadyTerrain() && !ground->GetTerrainMask()->IsSolid(position.x, position.y)) return false;
+            m_life[i] = 0.0f;
+            return true;
+        });
+    }
+}
+
+std::size_t ProjectileSystem::CollideWithTargets(ProjectileOwner owner, const std::vector<Circle>& targets,
+                                                 std::vector<std::uint8_t>& hitFlags) noexcept {
+    hitFlags.assign(targets.size(), 0);
+    if (targets.empty() || m_count == 0) {
+        return 0;
+    }
+
+    // Broad phase: one box around every target rejects most projectiles with four compares
+    float minX = targets.front().center.x;
+    float maxX = minX;
+    float minY = targets.front().center.y;
+    float maxY = minY;
+    for (const Circle& target : targets) {
+        minX = std::min(minX, target.center.x - target.radius);
+        maxX = std::max(maxX, target.center.x + target.radius);
+        minY = std::min(minY, target.center.y - target.radius);
+        maxY = std::max(maxY, target.center.y + target.radius);
+    }
+
+    std::size_t hitCount = 0;
+    for (std::size_t i = 0; i < m_count; ++i) {
+        if (m_owner[i] != owner || m_life[i] <= 0.0f) continue;
+
+        const float x = m_x[i];
+        const float y = m_y[i];
+        const float radius = m_radius[i];
+        if (x + radius < minX || x - radius > maxX || y + radius < minY || y - radius > maxY) continue;
+
+        for (std::size_t target = 0; target < targets.size(); ++target) {
+            const float deltaX = targets[target].center.x - x;
+            const float deltaY = targets[target].center.y - y;
+            const float reach = targets[target].radius + radius;
+            if (deltaX * deltaX + deltaY * deltaY < reach * reach) {
+                hitFlags[target] = 1;
+                m_life[i] = 0.0f;
+                ++hitCount;
+                break;
+            }
+        }
+    }
+    return hitCount;
+}
+
+void ProjectileSystem::MoveProjectile(std::size_t from, std::size_t to) noexcept {
+    m_x[to] = m_x[from];
+    m_y[to] = m_y[from];
+    m_velocityX[to] = m_velocityX[from];
+    m_velocityY[to] = m_velocityY[from];
+    m_radius[to] = m_radius[from];
+    m_life[to] = m_life[from];
+    m_gravityScale[to] = m_gravityScale[from];
+    m_owner[to] = m_owner[from];
+}
+
+void ProjectileSystem::RemoveDead() noexcept {
+    // Swap-and-pop keeps the live range dense; order is not preserved but is deterministic
+    std::size_t i = 0;
+    while (i < m_count) {
+        if (m_life[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        --m_count;
+        if (i != m_count) {
+            MoveProjectile(m_count, i);
+        }
+    }
+}
+
+void ProjectileSystem::Draw(const Rectangle& visibleArea) const {
+    if (m_count == 0) return;
+
+    const float left = visibleArea.x;
+    const float top = visibleArea.y;
+    const float right = visibleArea.x + visibleArea.width;
+    const float bottom = visibleArea.y + visibleArea.height;
+
+    // One quad per projectile, written straight into the batch; the writer reserves again when it fills
+    rlSetTexture(m_sprite.id != 0 ? m_sprite.id : rlGetTextureIdDefault());
+    rlBegin(RL_QUADS);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    QuadWriter quads;
+    quads.Begin();
+    for (std::size_t i = 0; i < m_count; ++i) {
+        const float x = m_x[i];
+        const float y = m_y[i];
+        const float radius = m_radius[i];
+        if (x + radius < left || x - radius > right || y + radius < top || y - radius > bottom) continue;
+
+        const Color color = (m_owner[i] == ProjectileOwner::Player) ? PLAYER_SHOT_COLOR : ENEMY_SHOT_COLOR;
+        quads.Add({x, y}, radius, color);
+    }
+    quads.Finish();
+    rlEnd();
+    rlSetTexture(0);
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,58 @@
+#include "QuadWriter.hpp"
+
+namespace PlayAsGobo {
+
+void QuadWriter::Begin() noexcept {
+    Finish();
+    m_isActive = true;
+#if defined(RLGL_HAS_RESERVE_VERTICES)
+    m_useFallback = false;
+#else
+    m_useFallback = true;
+#endif
+}
+
+void QuadWriter::Finish() noexcept {
+    if (!m_isActive) return;
+
+#if defined(RLGL_HAS_RESERVE_VERTICES)
+    rlCommitVertices(m_used);
+#endif
+    m_vertices = nullptr;
+    m_texcoords = nullptr;
+    m_colors = nullptr;
+    m_capacity = 0;
+    m_used = 0;
+    m_isActive = false;
+}
+
+void QuadWriter::Reserve() noexcept {
+    if (m_useFallback) return;
+
+#if defined(RLGL_HAS_RESERVE_VERTICES)
+    // The full span goes in first; the new reservation may flush the batch
+    rlCommitVertices(m_used);
+    m_used = 0;
+
+    const rlVertexSpan span = rlReserveVertices(RESERVE_REQUEST);
+    m_vertices = span.vertices;
+    m_texcoords = span.texcoords;
+    m_colors = span.colors;
+    m_capacity = span.count;
+    m_useFallback = (span.count < 4);
+#endif
+}
+
+void QuadWriter::AddFallback(Vector2 center, float halfSize, Color color) noexcept {
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlTexCoord2f(0.0f, 0.0f);
+    rlVertex2f(center.x - halfSize, center.y - halfSize);
+    rlTexCoord2f(0.0f, 1.0f);
+    rlVertex2f(center.x - halfSize, center.y + halfSize);
+    rlTexCoord2f(1.0f, 1.0f);
+    rlVertex2f(center.x + halfSize, center.y + halfSize);
+    rlTexCoord2f(1.0f, 0.0f);
+    rlVertex2f(center.x + halfSize, center.y - halfSize);
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,43 @@
+#include "SessionArena.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace PlayAsGobo {
+
+SessionArena::SessionArena(std::size_t capacityBytes)
+    : m_capacity(capacityBytes) {
+    ValidateCapacity(capacityBytes);
+    m_buffer = std::make_unique<std::byte[]>(capacityBytes);
+}
+
+void SessionArena::ValidateCapacity(std::size_t capacityBytes) const {
+    if (capacityBytes < MIN_CAPACITY) {
+        throw std::invalid_argument("SessionArena capacity cannot be less than " +
+                                  std::to_string(MIN_CAPACITY) + " bytes");
+    }
+}
+
+void* SessionArena::Allocate(std::size_t size, std::size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("SessionArena alignment must be a power of two");
+    }
+
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_buffer.get());
+    const std::uintptr_t current = base + m_offset;
+    const std::uintptr_t aligned = (current + alignment - 1) & ~(alignment - 1);
+    const std::size_t newOffset = static_cast<std::size_t>(aligned - base) + size;
+
+    if (newOffset > m_capacity) {
+        throw std::runtime_error("SessionArena capacity exceeded (" +
+                               std::to_string(m_capacity) + " bytes)");
+    }
+
+    m_offset = newOffset;
+    if (m_offset > m_highWaterMark) {
+        m_highWaterMark = m_offset;
+    }
+
+    return reinterpret_cast<void*>(aligned);
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,263 @@
+#include "SpectatorClient.hpp"
+#include "EnemyArchetype.hpp"
+#include "raymath.h"
+#include <algorithm>
+#include <iostream>
+
+namespace PlayAsGobo {
+
+namespace {
+
+using SpectatorProtocol::Entity;
+using SpectatorProtocol::EntityKind;
+
+constexpr std::array<const char*, 3> PLAYER_TEXTURE_PATHS = {
+    "assets/img/Gobo/Gobo0.png",
+    "assets/img/Gobo/Gobo1.png",
+    "assets/img/Gobo/Gobo2.png"
+};
+
+constexpr std::array<const char*, 4> ENEMY_TEXTURE_PATHS = {
+    "assets/img/Juicy Boy's Brother/Juicy Boy's Brother0.png",
+    "assets/img/Juicy Boy's Brother/Juicy Boy's Brother1.png",
+    "assets/img/Juicy Boy's Brother/Juicy Boy's Brother2.png",
+    "assets/img/Juicy Boy's Brother/Juicy Boy's Brother3.png"
+};
+
+constexpr float EMITTER_FLASH_PROGRESS = 0.25f; // Share of an explosion drawn with the white core
+
+Vector2 Dequantize(const Entity& entity) noexcept {
+    return {static_cast<float>(entity.x) / SpectatorProtocol::POSITION_SCALE,
+            static_cast<float>(entity.y) / SpectatorProtocol::POSITION_SCALE};
+}
+
+float DequantizeRadius(const Entity& entity) noexcept {
+    return static_cast<float>(entity.radius) / SpectatorProtocol::RADIUS_SCALE;
+}
+
+const Entity* FindEntity(const SpectatorProtocol::Snapshot& snapshot, std::uint32_t key) noexcept {
+    const auto it = std::lower_bound(snapshot.entities.begin(), snapshot.entities.end(), key,
+                                     [](const Entity& entity, std::uint32_t value) { return entity.key < value; });
+    return it != snapshot.entities.end() && it->key == key ? &*it : nullptr;
+}
+
+Rectangle ToRectangle(std::int32_t x, std::int32_t y, std::int32_t width, std::int32_t height) noexcept {
+    return {static_cast<float>(x), static_cast<float>(y), static_cast<float>(width), static_cast<float>(height)};
+}
+
+} // namespace
+
+SpectatorClient::~SpectatorClient() {
+    UnloadTextures();
+    if (IsWindowReady()) {
+        CloseWindow();
+    }
+}
+
+int SpectatorClient::Run(std::uint16_t serverPort) {
+    if (!m_socket.Open(0)) {
+        return -1;
+    }
+    m_server = UdpSocket::Loopback(serverPort);
+    for (SpectatorProtocol::Snapshot& snapshot : m_history) {
+        snapshot.sequence = SpectatorProtocol::NO_BASE;
+    }
+    m_receiveBuffer.resize(SpectatorProtocol::MAX_DATAGRAM_SIZE);
+
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_VSYNC_HINT);
+    InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Play As Gobo - Spectator");
+    if (!IsWindowReady()) {
+        std::cerr << "Failed to create spectator window" << std::endl;
+        return -1;
+    }
+    SetTargetFPS(60);
+    LoadTextures();
+
+    while (!WindowShouldClose()) {
+        const float deltaTime = GetFrameTime();
+        m_sinceLatest += deltaTime;
+        m_sinceHello += deltaTime;
+
+        ReceiveSnapshots();
+
+        // Keeps the server from timing us out while the game sits in a menu
+        if (m_sinceHello >= HELLO_INTERVAL) {
+            SendAck(m_latest != nullptr ? m_latest->sequence : SpectatorProtocol::NO_BASE);
+        }
+        UpdateStats(deltaTime);
+
+        BeginDrawing();
+        ClearBackground(SKYBLUE);
+        Draw();
+        DrawStatus();
+        EndDrawing();
+    }
+    return 0;
+}
+
+void SpectatorClient::LoadTextures() {
+    // Missing textures fall back to circles, so a spectator can run from anywhere
+    for (const char* path : PLAYER_TEXTURE_PATHS) {
+        if (Texture2D texture = LoadTexture(path); texture.id != 0) {
+            m_playerTextures.push_back(texture);
+        }
+    }
+    for (const char* path : ENEMY_TEXTURE_PATHS) {
+        if (Texture2D texture = LoadTexture(path); texture.id != 0) {
+            m_enemyTextures.push_back(texture);
+        }
+    }
+}
+
+void SpectatorClient::UnloadTextures() noexcept {
+    for (const Texture2D& texture : m_playerTextures) UnloadTexture(texture);
+    for (const Texture2D& texture : m_enemyTextures) UnloadTexture(texture);
+    m_playerTextures.clear();
+    m_enemyTextures.clear();
+}
+
+void SpectatorClient::ReceiveSnapshots() {
+    UdpEndpoint sender;
+    while (const std::size_t size = m_socket.Receive(m_receiveBuffer.data(), m_receiveBuffer.size(), sender)) {
+        if (!(sender == m_server)) continue;
+
+        std::uint32_t baseSequence = 0;
+        if (!SpectatorProtocol::PeekBaseSequence(m_receiveBuffer.data(), size, baseSequence)) continue;
+
+        const SpectatorProtocol::Snapshot* base = nullptr;
+        if (baseSequence != SpectatorProtocol::NO_BASE) {
+            base = &m_history[baseSequence % HISTORY_SIZE];
+            if (base->sequence != baseSequence) continue; // Base already evicted; a newer ack will fix it
+        }
+
+        // Decode into a scratch slot first so a malformed datagram can't clobber history
+        SpectatorProtocol::Snapshot decoded;
+        if (!SpectatorProtocol::DecodeSnapshot(m_receiveBuffer.data(), size, base, decoded)) continue;
+
+        // Late datagrams are still useful as delta bases, but never rewind the view
+        const bool isNewest = m_latest == nullptr ||
+                              static_cast<std::int32_t>(decoded.sequence - m_latest->sequence) > 0;
+        SpectatorProtocol::Snapshot& slot = m_history[decoded.sequence % HISTORY_SIZE];
+        if (&slot == m_previous) m_previous = nullptr;
+        if (&slot == m_latest) m_latest = nullptr;
+        slot = std::move(decoded);
+
+        m_bytesThisSecond += size;
+        ++m_snapshotsThisSecond;
+        m_lastSnapshotSize = size;
+
+        if (isNewest) {
+            m_previous = m_latest;
+            m_latest = &slot;
+            m_sinceLatest = 0.0f;
+            SendAck(slot.sequence);
+        }
+    }
+}
+
+void SpectatorClient::SendAck(std::uint32_t sequence) {
+    m_sendBuffer.clear();
+    SpectatorProtocol::EncodeAck(sequence, m_sendBuffer);
+    m_socket.SendTo(m_server, m_sendBuffer.data(), m_sendBuffer.size());
+    m_sinceHello = 0.0f;
+}
+
+void SpectatorClient::UpdateStats(float deltaTime) noexcept {
+    m_statsTimer += deltaTime;
+    if (m_statsTimer < STATS_INTERVAL) return;
+
+    m_bytesPerSecond = static_cast<float>(m_bytesThisSecond) / m_statsTimer;
+    m_snapshotsPerSecond = m_snapshotsThisSecond;
+    m_bytesThisSecond = 0;
+    m_snapshotsThisSecond = 0;
+    m_statsTimer = 0.0f;
+}
+
+void SpectatorClient::Draw() const {
+    if (m_latest == nullptr) return;
+
+    const SpectatorProtocol::WorldLayout& layout = m_latest->layout;
+    if (layout.groundWidth <= 0) return;
+
+    // Fit the whole map width and stand the ground on the bottom edge
+    Camera2D camera = {};
+    camera.zoom = static_cast<float>(GetScreenWidth()) / static_cast<float>(layout.groundWidth);
+    camera.target = {static_cast<float>(layout.groundX), static_cast<float>(layout.groundY + layout.groundHeight)};
+    camera.offset = {0.0f, static_cast<float>(GetScreenHeight())};
+
+    BeginMode2D(camera);
+    DrawRectangleRec(ToRectangle(layout.groundX, layout.groundY, layout.groundWidth, layout.groundHeight), DARKGREEN);
+    DrawRectangleRec(ToRectangle(layout.finishLineX, layout.finishLineY, layout.finishLineWidth,
+                                 layout.finishLineHeight), Fade(WHITE, 0.8f));
+
+    // Drawn one snapshot interval behind, blending towards the newest
+    const float blend = Clamp(m_sinceLatest / SNAPSHOT_INTERVAL, 0.0f, 1.0f);
+    for (const Entity& entity : m_latest->entities) {
+        Vector2 position = Dequantize(entity);
+        float radius = DequantizeRadius(entity);
+        if (const Entity* previous = m_previous != nullptr ? FindEntity(*m_previous, entity.key) : nullptr) {
+            position = Vector2Lerp(Dequantize(*previous), position, blend);
+            radius = Lerp(DequantizeRadius(*previous), radius, blend);
+        }
+        DrawEntity(entity, position, radius);
+    }
+    EndMode2D();
+}
+
+void SpectatorClient::DrawEntity(const Entity& entity, Vector2 position, float radius) const {
+    const Rectangle destRect = {position.x - radius, position.y - radius, radius * 2.0f, radius * 2.0f};
+    const bool facingLeft = (entity.flags & Entity::FLAG_FACING_LEFT) != 0;
+    const float sourceWidth = facingLeft ? -static_cast<float>(TEXTURE_RESOLUTION)
+                                         : static_cast<float>(TEXTURE_RESOLUTION);
+    const Rectangle sourceRect = {0.0f, 0.0f, sourceWidth, static_cast<float>(TEXTURE_RESOLUTION)};
+
+    switch (entity.GetKind()) {
+        case EntityKind::Player:
+            if (entity.frame < m_playerTextures.size()) {
+                DrawTexturePro(m_playerTextures[entity.frame], sourceRect, destRect, {0.0f, 0.0f}, 0.0f, WHITE);
+            } else {
+                DrawCircleV(position, radius, MAROON);
+            }
+            if (entity.flags & Entity::FLAG_BOMB_READY) {
+                DrawCircleLinesV(position, radius * 1.2f, RED);
+            }
+            break;
+
+        case EntityKind::Enemy: {
+            const auto archetype = static_cast<EnemyArchetype>(std::min<std::uint8_t>(
+                entity.flags >> 4, static_cast<std::uint8_t>(ENEMY_ARCHETYPE_COUNT - 1)));
+            const Color tint = GetEnemyArchetypeParams(archetype).tint;
+            if (entity.frame < m_enemyTextures.size()) {
+                DrawTexturePro(m_enemyTextures[entity.frame], sourceRect, destRect, {0.0f, 0.0f}, 0.0f, tint);
+            } else {
+                DrawCircleV(position, radius, tint);
+            }
+            break;
+        }
+
+        case EntityKind::Emitter: {
+            const float progress = static_cast<float>(entity.frame) / 255.0f;
+            DrawCircleV(position, radius, Fade(ORANGE, 1.0f - progress));
+            if (progress < EMITTER_FLASH_PROGRESS) {
+                DrawCircleV(position, radius * 0.5f, Fade(WHITE, 1.0f - progress / EMITTER_FLASH_PROGRESS));
+            }
+            break;
+        }
+    }
+}
+
+void SpectatorClient::DrawStatus() const {
+    if (m_latest == nullptr) {
+        DrawText(TextFormat("Waiting for a game broadcasting on 127.0.0.1:%d ...", m_server.port),
+                 20, 20, 20, DARKGRAY);
+        return;
+    }
+
+    DrawText(TextFormat("Kills: %d", m_latest->killCount), 20, 20, 20, BLACK);
+    DrawText(TextFormat("%.1f KB/s  %zu snapshots/s  last %zu B  %zu entities",
+                        m_bytesPerSecond / 1024.0f, m_snapshotsPerSecond, m_lastSnapshotSize,
+                        m_latest->entities.size()),
+             20, 44, 16, DARKGRAY);
+}
+
+} // namespace PlayAsGobo
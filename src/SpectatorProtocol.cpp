@@ -0,0 +1,303 @@
+#include "SpectatorProtocol.hpp"
+#include <algorithm>
+
+namespace PlayAsGobo {
+
+namespace SpectatorProtocol {
+
+namespace {
+
+constexpr std::size_t HEADER_SIZE = 4 + 1 + 1 + 4 + 4;
+constexpr std::size_t ACK_SIZE = 4 + 1 + 1 + 4;
+
+// Per-entity change mask
+constexpr std::uint8_t CHANGED_X = 1u << 0;
+constexpr std::uint8_t CHANGED_Y = 1u << 1;
+constexpr std::uint8_t CHANGED_RADIUS = 1u << 2;
+constexpr std::uint8_t CHANGED_FRAME = 1u << 3;
+constexpr std::uint8_t CHANGED_FLAGS = 1u << 4;
+
+// Snapshot-level flags
+constexpr std::uint8_t SNAPSHOT_HAS_LAYOUT = 1u << 0;
+
+void WriteU32(std::vector<std::uint8_t>& output, std::uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        output.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+std::uint32_t ReadU32(const std::uint8_t* data) noexcept {
+    return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) |
+           (static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+void WriteVarint(std::vector<std::uint8_t>& output, std::uint32_t value) {
+    while (value >= 0x80u) {
+        output.push_back(static_cast<std::uint8_t>(value | 0x80u));
+        value >>= 7;
+    }
+    output.push_back(static_cast<std::uint8_t>(value));
+}
+
+void WriteSigned(std::vector<std::uint8_t>& output, std::int32_t value) {
+    // Zigzag so small negative deltas stay one byte
+    const std::uint32_t bits = static_cast<std::uint32_t>(value);
+    WriteVarint(output, (bits << 1) ^ (value < 0 ? 0xFFFFFFFFu : 0u));
+}
+
+void WriteHeader(std::vector<std::uint8_t>& output, PacketType type, std::uint32_t sequence) {
+    WriteU32(output, MAGIC);
+    output.push_back(VERSION);
+    output.push_back(static_cast<std::uint8_t>(type));
+    WriteU32(output, sequence);
+}
+
+// Bounds-checked cursor over a received datagram
+class Reader {
+public:
+    Reader(const std::uint8_t* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+    [[nodiscard]] bool ReadByte(std::uint8_t& value) noexcept {
+        if (m_position >= m_size) return false;
+        value = m_data[m_position++];
+        return true;
+    }
+
+    [[nodiscard]] bool ReadVarint(std::uint32_t& value) noexcept {
+        value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            std::uint8_t byte = 0;
+            if (!ReadByte(byte)) return false;
+            value |= static_cast<std::uint32_t>(byte & 0x7Fu) << shift;
+            if ((byte & 0x80u) == 0) return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool ReadSigned(std::int32_t& value) noexcept {
+        std::uint32_t bits = 0;
+        if (!ReadVarint(bits)) return false;
+        value = static_cast<std::int32_t>((bits >> 1) ^ (0u - (bits & 1u)));
+        return true;
+    }
+
+    [[nodiscard]] bool IsAtEnd() const noexcept { return m_position == m_size; }
+
+private:
+    const std::uint8_t* m_data;
+    std::size_t m_size;
+    std::size_t m_position{HEADER_SIZE};
+};
+
+bool CheckHeader(const std::uint8_t* data, std::size_t size, PacketType type, std::size_t minimumSize) noexcept {
+    return data != nullptr && size >= minimumSize && ReadU32(data) == MAGIC && data[4] == VERSION &&
+           data[5] == static_cast<std::uint8_t>(type);
+}
+
+void WriteLayout(std::vector<std::uint8_t>& output, const WorldLayout& layout) {
+    WriteSigned(output, layout.groundX);
+    WriteSigned(output, layout.groundY);
+    WriteSigned(output, layout.groundWidth);
+    WriteSigned(output, layout.groundHeight);
+    WriteSigned(output, layout.finishLineX);
+    WriteSigned(output, layout.finishLineY);
+    WriteSigned(output, layout.finishLineWidth);
+    WriteSigned(output, layout.finishLineHeight);
+}
+
+bool ReadLayout(Reader& reader, WorldLayout& layout) noexcept {
+    return reader.ReadSigned(layout.groundX) && reader.ReadSigned(layout.groundY) &&
+           reader.ReadSigned(layout.groundWidth) && reader.ReadSigned(layout.groundHeight) &&
+           reader.ReadSigned(layout.finishLineX) && reader.ReadSigned(layout.finishLineY) &&
+           reader.ReadSigned(layout.finishLineWidth) && reader.ReadSigned(layout.finishLineHeight);
+}
+
+// Writes current as changes against previous (a zeroed entity when it is new)
+void WriteEntity(std::vector<std::uint8_t>& output, const Entity& previous, const Entity& current) {
+    std::uint8_t mask = 0;
+    if (current.x != previous.x) mask |= CHANGED_X;
+    if (current.y != previous.y) mask |= CHANGED_Y;
+    if (current.radius != previous.radius) mask |= CHANGED_RADIUS;
+    if (current.frame != previous.frame) mask |= CHANGED_FRAME;
+    if (current.flags != previous.flags) mask |= CHANGED_FLAGS;
+
+    output.push_back(mask);
+    if (mask & CHANGED_X) WriteSigned(output, current.x - previous.x);
+    if (mask & CHANGED_Y) WriteSigned(output, current.y - previous.y);
+    if (mask & CHANGED_RADIUS) WriteVarint(output, current.radius);
+    if (mask & CHANGED_FRAME) output.push_back(current.frame);
+    if (mask & CHANGED_FLAGS) output.push_back(current.flags);
+}
+
+bool ReadEntity(Reader& reader, Entity& entity) noexcept {
+    std::uint8_t mask = 0;
+    if (!reader.ReadByte(mask)) return false;
+
+    std::int32_t delta = 0;
+    std::uint32_t radius = 0;
+    if ((mask & CHANGED_X) && !reader.ReadSigned(delta)) return false;
+    if (mask & CHANGED_X) entity.x += delta;
+    if ((mask & CHANGED_Y) && !reader.ReadSigned(delta)) return false;
+    if (mask & CHANGED_Y) entity.y += delta;
+    if (mask & CHANGED_RADIUS) {
+        if (!reader.ReadVarint(radius) || radius > 0xFFFFu) return false;
+        entity.radius = static_cast<std::uint16_t>(radius);
+    }
+    if ((mask & CHANGED_FRAME) && !reader.ReadByte(entity.frame)) return false;
+    if ((mask & CHANGED_FLAGS) && !reader.ReadByte(entity.flags)) return false;
+    return true;
+}
+
+} // namespace
+
+bool WorldLayout::operator==(const WorldLayout& other) const noexcept {
+    return groundX == other.groundX && groundY == other.groundY && groundWidth == other.groundWidth &&
+           groundHeight == other.groundHeight && finishLineX == other.finishLineX &&
+           finishLineY == other.finishLineY && finishLineWidth == other.finishLineWidth &&
+           finishLineHeight == other.finishLineHeight;
+}
+
+void EncodeSnapshot(const Snapshot& current, const Snapshot* base, std::vector<std::uint8_t>& output) {
+    WriteHeader(output, PacketType::Snapshot, current.sequence);
+    WriteU32(output, base != nullptr ? base->sequence : NO_BASE);
+
+    const bool hasLayout = base == nullptr || !(base->layout == current.layout);
+    output.push_back(hasLayout ? SNAPSHOT_HAS_LAYOUT : 0);
+    if (hasLayout) {
+        WriteLayout(output, current.layout);
+    }
+    WriteSigned(output, current.killCount - (base != nullptr ? base->killCount : 0));
+
+    // Both lists are sorted by key, so one merge pass finds the changed, new
+    // and removed entities. Changes go out first, then the removed keys; keys
+    // are written as gaps from the previous key in the same list.
+    static const std::vector<Entity> NO_ENTITIES;
+    const std::vector<Entity>& previous = base != nullptr ? base->entities : NO_ENTITIES;
+
+    const std::size_t countOffset = output.size();
+    output.insert(output.end(), 3, 0); // Changed count, patched below
+    std::uint32_t changedCount = 0;
+    std::uint32_t lastKey = 0;
+    std::size_t p = 0;
+    for (const Entity& entity : current.entities) {
+        while (p < previous.size() && previous[p].key < entity.key) ++p;
+
+        const bool existed = p < previous.size() && previous[p].key == entity.key;
+        if (existed && previous[p] == entity) continue;
+
+        WriteVarint(output, entity.key - lastKey);
+        lastKey = entity.key;
+        WriteEntity(output, existed ? previous[p] : Entity{entity.key}, entity);
+        ++changedCount;
+    }
+
+    // Three-byte varint patched in place; 2^21 entities is far past any datagram
+    output[countOffset] = static_cast<std::uint8_t>(changedCount | 0x80u);
+    output[countOffset + 1] = static_cast<std::uint8_t>((changedCount >> 7) | 0x80u);
+    output[countOffset + 2] = static_cast<std::uint8_t>((changedCount >> 14) & 0x7Fu);
+
+    std::vector<std::uint32_t> removed;
+    std::size_t c = 0;
+    for (const Entity& entity : previous) {
+        while (c < current.entities.size() && current.entities[c].key < entity.key) ++c;
+        if (c >= current.entities.size() || current.entities[c].key != entity.key) {
+            removed.push_back(entity.key);
+        }
+    }
+
+    WriteVarint(output, static_cast<std::uint32_t>(removed.size()));
+    lastKey = 0;
+    for (const std::uint32_t key : removed) {
+        WriteVarint(output, key - lastKey);
+        lastKey = key;
+    }
+}
+
+bool PeekBaseSequence(const std::uint8_t* data, std::size_t size, std::uint32_t& baseSequence) noexcept {
+    if (!CheckHeader(data, size, PacketType::Snapshot, HEADER_SIZE)) return false;
+    baseSequence = ReadU32(data + 10);
+    return true;
+}
+
+bool DecodeSnapshot(const std::uint8_t* data, std::size_t size, const Snapshot* base, Snapshot& output) {
+    std::uint32_t baseSequence = 0;
+    if (!PeekBaseSequence(data, size, baseSequence)) return false;
+    if ((baseSequence == NO_BASE) != (base == nullptr)) return false;
+    if (base != nullptr && base->sequence != baseSequence) return false;
+
+    Reader reader(data, size);
+    output.sequence = ReadU32(data + 6);
+
+    std::uint8_t snapshotFlags = 0;
+    if (!reader.ReadByte(snapshotFlags)) return false;
+    if (snapshotFlags & SNAPSHOT_HAS_LAYOUT) {
+        if (!ReadLayout(reader, output.layout)) return false;
+    } else if (base != nullptr) {
+        output.layout = base->layout;
+    } else {
+        return false;
+    }
+
+    std::int32_t killDelta = 0;
+    if (!reader.ReadSigned(killDelta)) return false;
+    output.killCount = (base != nullptr ? base->killCount : 0) + killDelta;
+
+    static const std::vector<Entity> NO_ENTITIES;
+    const std::vector<Entity>& previous = base != nullptr ? base->entities : NO_ENTITIES;
+
+    std::uint32_t changedCount = 0;
+    if (!reader.ReadVarint(changedCount) || changedCount > size) return false;
+
+    // Merge unchanged base entities with the changed ones, keeping key order
+    output.entities.clear();
+    output.entities.reserve(previous.size() + changedCount);
+    std::size_t p = 0;
+    std::uint32_t key = 0;
+    for (std::uint32_t i = 0; i < changedCount; ++i) {
+        std::uint32_t gap = 0;
+        if (!reader.ReadVarint(gap)) return false;
+        if (i > 0 && gap == 0) return false;
+        key += gap;
+
+        while (p < previous.size() && previous[p].key < key) {
+            output.entities.push_back(previous[p++]);
+        }
+        Entity entity{key};
+        if (p < previous.size() && previous[p].key == key) {
+            entity = previous[p++];
+        }
+        if (!ReadEntity(reader, entity)) return false;
+        output.entities.push_back(entity);
+    }
+    output.entities.insert(output.entities.end(), previous.begin() + static_cast<std::ptrdiff_t>(p), previous.end());
+
+    std::uint32_t removedCount = 0;
+    if (!reader.ReadVarint(removedCount) || removedCount > size) return false;
+    key = 0;
+    for (std::uint32_t i = 0; i < removedCount; ++i) {
+        std::uint32_t gap = 0;
+        if (!reader.ReadVarint(gap)) return false;
+        key += gap;
+        const auto it = std::lower_bound(output.entities.begin(), output.entities.end(), key,
+                                         [](const Entity& entity, std::uint32_t value) { return entity.key < value; });
+        if (it != output.entities.end() && it->key == key) {
+            output.entities.erase(it);
+        }
+    }
+
+    return reader.IsAtEnd();
+}
+
+void EncodeAck(std::uint32_t sequence, std::vector<std::uint8_t>& output) {
+    WriteHeader(output, PacketType::Ack, sequence);
+}
+
+bool DecodeAck(const std::uint8_t* data, std::size_t size, std::uint32_t& sequence) noexcept {
+    if (!CheckHeader(data, size, PacketType::Ack, ACK_SIZE) || size != ACK_SIZE) return false;
+    sequence = ReadU32(data + 6);
+    return true;
+}
+
+} // namespace SpectatorProtocol
+
+} // namespace PlayAsGobo
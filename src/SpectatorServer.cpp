@@ -0,0 +1,115 @@
+#include "SpectatorServer.hpp"
+#include <iostream>
+
+namespace PlayAsGobo {
+
+bool SpectatorServer::Open(std::uint16_t port) {
+    for (SpectatorProtocol::Snapshot& snapshot : m_history) {
+        snapshot.sequence = SpectatorProtocol::NO_BASE;
+    }
+    m_clientCount = 0;
+    m_sendBuffer.reserve(SpectatorProtocol::MAX_DATAGRAM_SIZE);
+
+    if (!m_socket.Open(port)) {
+        return false;
+    }
+    std::cout << "Spectator stream listening on 127.0.0.1:" << port << std::endl;
+    return true;
+}
+
+void SpectatorServer::Close() noexcept {
+    m_socket.Close();
+    m_clientCount = 0;
+}
+
+void SpectatorServer::Poll() {
+    if (!m_socket.IsOpen()) return;
+
+    UdpEndpoint sender;
+    while (const std::size_t size = m_socket.Receive(m_receiveBuffer.data(), m_receiveBuffer.size(), sender)) {
+        std::uint32_t sequence = 0;
+        if (SpectatorProtocol::DecodeAck(m_receiveBuffer.data(), size, sequence)) {
+            HandleAck(sender, sequence);
+        }
+    }
+    DropSilentClients();
+}
+
+bool SpectatorServer::IsSnapshotDue() noexcept {
+    // Nobody watching, nothing to build
+    if (m_clientCount == 0) return false;
+    return m_tickCounter++ % SEND_INTERVAL_TICKS == 0;
+}
+
+SpectatorProtocol::Snapshot& SpectatorServer::BeginSnapshot() noexcept {
+    // Sequences skip NO_BASE so it can keep meaning "keyframe"
+    if (m_nextSequence == SpectatorProtocol::NO_BASE) m_nextSequence = 0;
+
+    SpectatorProtocol::Snapshot& snapshot = m_history[m_nextSequence % HISTORY_SIZE];
+    snapshot.sequence = m_nextSequence;
+    snapshot.killCount = 0;
+    snapshot.layout = {};
+    snapshot.entities.clear(); // Keeps its capacity, so steady state does not allocate
+    return snapshot;
+}
+
+void SpectatorServer::SendSnapshot() {
+    const SpectatorProtocol::Snapshot& current = m_history[m_nextSequence % HISTORY_SIZE];
+    ++m_nextSequence;
+
+    const Clock::time_point start = Clock::now();
+    for (std::size_t i = 0; i < m_clientCount; ++i) {
+        const Client& client = m_clients[i];
+        m_sendBuffer.clear();
+        SpectatorProtocol::EncodeSnapshot(current, FindSnapshot(client.ackedSequence), m_sendBuffer);
+        m_socket.SendTo(client.endpoint, m_sendBuffer.data(), m_sendBuffer.size());
+    }
+    m_lastEncodeMicroseconds = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+const SpectatorProtocol::Snapshot* SpectatorServer::FindSnapshot(std::uint32_t sequence) const noexcept {
+    if (sequence == SpectatorProtocol::NO_BASE) return nullptr;
+
+    // The slot may have been overwritten since the ack; fall back to a keyframe then
+    const SpectatorProtocol::Snapshot& snapshot = m_history[sequence % HISTORY_SIZE];
+    return snapshot.sequence == sequence ? &snapshot : nullptr;
+}
+
+void SpectatorServer::HandleAck(const UdpEndpoint& sender, std::uint32_t sequence) {
+    for (std::size_t i = 0; i < m_clientCount; ++i) {
+        Client& client = m_clients[i];
+        if (client.endpoint == sender) {
+            // Acks can arrive out of order; only move forward
+            if (sequence != SpectatorProtocol::NO_BASE &&
+                (client.ackedSequence == SpectatorProtocol::NO_BASE ||
+                 static_cast<std::int32_t>(sequence - client.ackedSequence) > 0)) {
+                client.ackedSequence = sequence;
+            }
+            client.lastHeard = Clock::now();
+            return;
+        }
+    }
+
+    if (m_clientCount == MAX_CLIENTS) {
+        std::cerr << "Warning: Spectator limit reached, ignoring 127.0.0.1:" << sender.port << std::endl;
+        return;
+    }
+
+    // New clients always start from a keyframe
+    m_clients[m_clientCount++] = Client{sender, SpectatorProtocol::NO_BASE, Clock::now()};
+    std::cout << "Spectator connected from 127.0.0.1:" << sender.port << std::endl;
+}
+
+void SpectatorServer::DropSilentClients() {
+    const Clock::time_point now = Clock::now();
+    for (std::size_t i = 0; i < m_clientCount;) {
+        if (now - m_clients[i].lastHeard > CLIENT_TIMEOUT) {
+            std::cout << "Spectator 127.0.0.1:" << m_clients[i].endpoint.port << " timed out" << std::endl;
+            m_clients[i] = m_clients[--m_clientCount];
+        } else {
+            ++i;
+        }
+    }
+}
+
+} // namespace PlayAsGobo
@@ -0,0 +1,122 @@
+#include "StateHash.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace PlayAsGobo {
+
+const char* GetStateHashFieldName(StateHashField field) noexcept {
+    switch (field) {
+        case StateHashField::Player:      return "Player";
+        case StateHashField::Enemies:     return "Enemies";
+        case StateHashField::Explosions:  return "Explosions";
+        case StateHashField::Projectiles: return "Projectiles";
+        case StateHashField::Terrain:     return "Terrain";
+        case StateHashField::Timers:      return "Timers";
+        case StateHashField::Random:      return "Random";
+        case StateHashField::Count:       break;
+    }
+    return "Unknown";
+}
+
+bool StateHashLog::Open(const std::string& path) {
+    Close();
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file) {
+        std::cerr << "Warning: Could not open state hash log " << path << std::endl;
+        return false;
+    }
+
+    Header header;
+    header.magic = MAGIC;
+    header.version = FILE_VERSION;
+    header.fieldCount = static_cast<std::uint32_t>(STATE_HASH_FIELD_COUNT);
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return static_cast<bool>(m_file);
+}
+
+void StateHashLog::Append(const StateHashRecord& record) {
+    if (!m_file.is_open()) return;
+
+    // ofstream buffers, so this is a memcpy on almost every tick
+    m_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void StateHashLog::Close() noexcept {
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+}
+
+bool StateHashLog::Load(const std::string& path, std::vector<StateHashRecord>& records) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Could not open state hash log: " << path << std::endl;
+        return false;
+    }
+
+    Header header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != MAGIC) {
+        std::cerr << "Not a state hash log: " << path << std::endl;
+        return false;
+    }
+    if (header.version != FILE_VERSION || header.fieldCount != STATE_HASH_FIELD_COUNT) {
+        std::cerr << "Unsupported state hash log version " << header.version << ": " << path << std::endl;
+        return false;
+    }
+
+    records.clear();
+    StateHashRecord record;
+    while (file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        records.push_back(record);
+    }
+    return true;
+}
+
+int StateHashLog::Compare(const std::string& firstPath, const std::string& secondPath, std::ostream& output) {
+    std::vector<StateHashRecord> first;
+    std::vector<StateHashRecord> second;
+    if (!Load(firstPath, first) || !Load(secondPath, second)) {
+        return 2;
+    }
+
+    const std::size_t commonCount = std::min(first.size(), second.size());
+    for (std::size_t i = 0; i < commonCount; ++i) {
+        const StateHashRecord& a = first[i];
+        const StateHashRecord& b = second[i];
+        if (a.tick == b.tick && a.combined == b.combined) {
+            continue;
+        }
+
+        if (a.tick != b.tick) {
+            output << "Logs diverge at record " << i << ": tick " << a.tick << " vs tick " << b.tick
+                   << " (a session restarted in one run only)\n";
+            return 1;
+        }
+
+        output << "First divergence at tick " << a.tick << " (record " << i << ")\n";
+        for (std::size_t field = 0; field < STATE_HASH_FIELD_COUNT; ++field) {
+            if (a.fields[field] != b.fields[field]) {
+                output << "  " << std::left << std::setw(11)
+                       << GetStateHashFieldName(static_cast<StateHashField>(field)) << std::right
+                       << std::hex << std::setfill('0')
+                       << std::setw(16) << a.fields[field] << " != " << std::setw(16) << b.fields[field]
+                       << std::dec << std::setfill(' ') << "\n";
+            }
+        }
+        return 1;
+    }
+
+    if (first.size() != second.size()) {
+        output << "Logs match for " << commonCount << " ticks, then one run ends ("
+               << first.size() << " vs " << second.size() << " ticks)\n";
+        return 1;
+    }
+
+    output << "Logs match for all " << commonCount << " ticks\n";
+    return 0;
+}
+
+} // namespace PlayAsGobo
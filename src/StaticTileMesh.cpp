@@ -0,0 +1,161 @@
+#include "StaticTileMesh.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <utility>
+
+namespace PlayAsGobo {
+
+StaticTileMesh::~StaticTileMesh() {
+    Unload();
+}
+
+bool StaticTileMesh::Build(const Texture2D& texture, const std::vector<StaticTile>& tiles) {
+    Unload();
+    if (texture.id == 0 || texture.width <= 0 || texture.height <= 0 || tiles.empty()) {
+        return false;
+    }
+    m_texture = texture;
+
+    // Bucket tiles by the chunk their top-left corner falls in; a chunk's bounds
+    // grow to cover tiles that overhang it, so culling stays exact
+    std::map<std::pair<std::int32_t, std::int32_t>, std::vector<const StaticTile*>> buckets;
+    for (const StaticTile& tile : tiles) {
+        const auto chunkX = static_cast<std::int32_t>(std::floor(tile.destination.x / CHUNK_SIZE));
+        const auto chunkY = static_cast<std::int32_t>(std::floor(tile.destination.y / CHUNK_SIZE));
+        buckets[{chunkX, chunkY}].push_back(&tile);
+    }
+
+    std::vector<const StaticTile*> batch;
+    for (const auto& [key, bucket] : buckets) {
+        for (std::size_t first = 0; first < bucket.size(); first += MAX_QUADS_PER_CHUNK) {
+            const std::size_t last = std::min(bucket.size(), first + MAX_QUADS_PER_CHUNK);
+            batch.assign(bucket.begin() + static_cast<std::ptrdiff_t>(first),
+                         bucket.begin() + static_cast<std::ptrdiff_t>(last));
+
+            Chunk chunk;
+            if (!UploadChunk(batch, chunk)) {
+                Unload();
+                return false;
+            }
+            m_chunks.push_back(chunk);
+        }
+    }
+
+    m_tileCount = tiles.size();
+    return true;
+}
+
+void StaticTileMesh::Unload() noexcept {
+    for (const Chunk& chunk : m_chunks) {
+        rlUnloadVertexBuffer(chunk.vertexBuffer);
+        rlUnloadVertexBuffer(chunk.indexBuffer);
+        rlUnloadVertexArray(chunk.vertexArray);
+    }
+    m_chunks.clear();
+    m_tileCount = 0;
+    m_texture = Texture2D{};
+}
+
+bool StaticTileMesh::UploadChunk(const std::vector<const StaticTile*>& tiles, Chunk& chunk) const {
+    const float textureWidth = static_cast<float>(m_texture.width);
+    const float textureHeight = static_cast<float>(m_texture.height);
+
+    std::vector<Vertex> vertices;
+    std::vector<std::uint16_t> indices;
+    vertices.reserve(tiles.size() * 4);
+    indices.reserve(tiles.size() * 6);
+
+    float minX = tiles.front()->destination.x;
+    float minY = tiles.front()->destination.y;
+    float maxX = minX;
+    float maxY = minY;
+
+    for (const StaticTile* tile : tiles) {
+        const Rectangle& dest = tile->destination;
+        const float u0 = tile->source.x / textureWidth;
+        const float v0 = tile->source.y / textureHeight;
+        const float u1 = (tile->source.x + tile->source.width) / textureWidth;
+        const float v1 = (tile->source.y + tile->source.height) / textureHeight;
+        const Color c = tile->tint;
+
+        const auto base = static_cast<std::uint16_t>(vertices.size());
+        vertices.push_back({dest.x, dest.y, 0.0f, u0, v0, c.r, c.g, c.b, c.a});
+        vertices.push_back({dest.x, dest.y + dest.height, 0.0f, u0, v1, c.r, c.g, c.b, c.a});
+        vertices.push_back({dest.x + dest.width, dest.y + dest.height, 0.0f, u1, v1, c.r, c.g, c.b, c.a});
+        vertices.push_back({dest.x + dest.width, dest.y, 0.0f, u1, v0, c.r, c.g, c.b, c.a});
+
+        // Same winding as the rlgl batch's quads
+        for (const std::uint16_t offset : {0, 1, 2, 0, 2, 3}) {
+            indices.push_back(static_cast<std::uint16_t>(base + offset));
+        }
+
+        minX = std::min(minX, dest.x);
+        minY = std::min(minY, dest.y);
+        maxX = std::max(maxX, dest.x + dest.width);
+        maxY = std::max(maxY, dest.y + dest.height);
+    }
+
+    chunk.vertexArray = rlLoadVertexArray();
+    if (chunk.vertexArray == 0) {
+        return false;
+    }
+
+    rlEnableVertexArray(chunk.vertexArray);
+    chunk.vertexBuffer = rlLoadVertexBuffer(vertices.data(), static_cast<int>(vertices.size() * sizeof(Vertex)), false);
+
+    constexpr int stride = static_cast<int>(sizeof(Vertex));
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, false, stride,
+                         static_cast<int>(offsetof(Vertex, x)));
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, false, stride,
+                         static_cast<int>(offsetof(Vertex, u)));
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true, stride,
+                         static_cast<int>(offsetof(Vertex, r)));
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+
+    // Bound while the vertex array is, so the array remembers it
+    chunk.indexBuffer = rlLoadVertexBufferElement(indices.data(),
+                                                  static_cast<int>(indices.size() * sizeof(std::uint16_t)), false);
+    rlDisableVertexArray();
+
+    chunk.indexCount = static_cast<int>(indices.size());
+    chunk.bounds = {minX, minY, maxX - minX, maxY - minY};
+    return true;
+}
+
+void StaticTileMesh::Draw(const Rectangle& visibleArea) const {
+    if (m_chunks.empty()) return;
+
+    // Earlier 2D draws are still queued in the batch and must land underneath
+    rlDrawRenderBatchActive();
+
+    // Same state the batch uses: default shader, camera modelview, texture slot 0
+    const int* locations = rlGetShaderLocsDefault();
+    rlEnableShader(rlGetShaderIdDefault());
+    rlSetUniformMatrix(locations[RL_SHADER_LOC_MATRIX_MVP],
+                       MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    constexpr float WHITE_DIFFUSE[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    rlSetUniform(locations[RL_SHADER_LOC_COLOR_DIFFUSE], WHITE_DIFFUSE, RL_SHADER_UNIFORM_VEC4, 1);
+    constexpr int TEXTURE_SLOT = 0;
+    rlSetUniform(locations[RL_SHADER_LOC_MAP_DIFFUSE], &TEXTURE_SLOT, RL_SHADER_UNIFORM_INT, 1);
+    rlActiveTextureSlot(TEXTURE_SLOT);
+    rlEnableTexture(m_texture.id);
+
+    for (const Chunk& chunk : m_chunks) {
+        if (!CheckCollisionRecs(chunk.bounds, visibleArea)) continue;
+
+        rlEnableVertexArray(chunk.vertexArray);
+        rlDrawVertexArrayElements(0, chunk.indexCount, nullptr);
+    }
+
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+} // namespace PlayAsGobo
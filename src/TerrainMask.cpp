@@ -0,0 +1,279 @@
+#include "TerrainMask.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace PlayAsGobo {
+
+namespace {
+
+constexpr float SCORCH_RIM_WIDTH = 3.0f;
+constexpr float SCORCH_DARKEN_FACTOR = 0.6f;
+constexpr Color FALLBACK_GROUND_COLOR = {0, 228, 48, 255};
+
+} // namespace
+
+TerrainMask::~TerrainMask() {
+    Unload();
+}
+
+void TerrainMask::Unload() noexcept {
+    if (m_texture.id != 0) {
+        UnloadTexture(m_texture);
+    }
+    m_texture = Texture2D{};
+    ResetDirty();
+}
+
+void TerrainMask::Rebuild(const Rectangle& bounds, const Image& tileImage) {
+    const std::int32_t width = std::clamp(static_cast<std::int32_t>(std::ceil(bounds.width)), 1, MAX_TEXTURE_DIMENSION);
+    const std::int32_t height = std::clamp(static_cast<std::int32_t>(std::ceil(bounds.height)), 1, MAX_TEXTURE_DIMENSION);
+
+    if (width < bounds.width || height < bounds.height) {
+        std::cerr << "Warning: Terrain is larger than " << MAX_TEXTURE_DIMENSION
+                  << " pixels and will be clipped" << std::endl;
+    }
+
+    m_bounds = bounds;
+    m_wordsPerRow = (width + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    m_solidBits.assign(static_cast<std::size_t>(m_wordsPerRow) * height, ~std::uint64_t{0});
+    m_pixels.resize(static_cast<std::size_t>(width) * height);
+
+    // Tile the ground image across the whole area once; carving only edits alpha from here on
+    if (tileImage.data != nullptr && tileImage.width > 0 && tileImage.height > 0) {
+        Color* tileColors = LoadImageColors(tileImage);
+        for (std::int32_t y = 0; y < height; ++y) {
+            const Color* tileRow = tileColors + static_cast<std::size_t>(y % tileImage.height) * tileImage.width;
+            Color* row = m_pixels.data() + static_cast<std::size_t>(y) * width;
+            for (std::int32_t x = 0; x < width; ++x) {
+                row[x] = tileRow[x % tileImage.width];
+            }
+        }
+        UnloadImageColors(tileColors);
+    } else {
+        std::fill(m_pixels.begin(), m_pixels.end(), FALLBACK_GROUND_COLOR);
+    }
+
+    // Reuse the texture when the size is unchanged (restarts), recreate it otherwise (resizes)
+    if (m_texture.id != 0 && m_texture.width == width && m_texture.height == height) {
+        UpdateTexture(m_texture, m_pixels.data());
+    } else {
+        Unload();
+
+        Image image{};
+        image.data = m_pixels.data();
+        image.width = width;
+        image.height = height;
+        image.mipmaps = 1;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        m_texture = LoadTextureFromImage(image);
+    }
+
+    m_width = width;
+    m_height = height;
+    ResetDirty();
+}
+
+std::int32_t TerrainMask::ToColumn(float x) const noexcept {
+    return static_cast<std::int32_t>(std::floor(x - m_bounds.x));
+}
+
+std::int32_t TerrainMask::ToRow(float y) const noexcept {
+    return static_cast<std::int32_t>(std::floor(y - m_bounds.y));
+}
+
+bool TerrainMask::IsCellSolid(std::int32_t column, std::int32_t row) const noexcept {
+    if (column < 0 || column >= m_width || row < 0 || row >= m_height) {
+        return false;
+    }
+
+    const std::uint64_t word = m_solidBits[static_cast<std::size_t>(row) * m_wordsPerRow + column / BITS_PER_WORD];
+    return ((word >> (column % BITS_PER_WORD)) & 1u) != 0;
+}
+
+bool TerrainMask::IsSolid(float x, float y) const noexcept {
+    return IsCellSolid(ToColumn(x), ToRow(y));
+}
+
+void TerrainMask::ClearRun(std::int32_t row, std::int32_t firstColumn, std::int32_t lastColumn) noexcept {
+    std::uint64_t* rowWords = m_solidBits.data() + static_cast<std::size_t>(row) * m_wordsPerRow;
+
+    const std::int32_t firstWord = firstColumn / BITS_PER_WORD;
+    const std::int32_t lastWord = lastColumn / BITS_PER_WORD;
+    const std::uint64_t firstMask = ~std::uint64_t{0} << (firstColumn % BITS_PER_WORD);
+    const std::uint64_t lastMask = ~std::uint64_t{0} >> (BITS_PER_WORD - 1 - lastColumn % BITS_PER_WORD);
+
+    if (firstWord == lastWord) {
+        rowWords[firstWord] &= ~(firstMask & lastMask);
+        return;
+    }
+
+    rowWords[firstWord] &= ~firstMask;
+    std::fill(rowWords + firstWord + 1, rowWords + lastWord, std::uint64_t{0});
+    rowWords[lastWord] &= ~lastMask;
+}
+
+void TerrainMask::Carve(Vector2 center, float radius) {
+    if (!IsReady() || radius <= 0.0f) return;
+
+    const float localX = center.x - m_bounds.x;
+    const float localY = center.y - m_bounds.y;
+    const float outerRadius = radius + SCORCH_RIM_WIDTH;
+
+    const std::int32_t firstRow = std::max(0, static_cast<std::int32_t>(std::floor(localY - outerRadius)));
+    const std::int32_t lastRow = std::min(m_height - 1, static_cast<std::int32_t>(std::floor(localY + outerRadius)));
+    if (firstRow > lastRow) return;
+
+    std::int32_t dirtyMinX = m_width;
+    std::int32_t dirtyMaxX = -1;
+
+    for (std::int32_t row = firstRow; row <= lastRow; ++row) {
+        const float deltaY = (static_cast<float>(row) + 0.5f) - localY;
+        if (std::abs(deltaY) > outerRadius) continue;
+
+        const float outerHalfWidth = std::sqrt(outerRadius * outerRadius - deltaY * deltaY);
+        const std::int32_t outerFirst = std::max(0, static_cast<std::int32_t>(std::floor(localX - outerHalfWidth)));
+        const std::int32_t outerLast = std::min(m_width - 1, static_cast<std::int32_t>(std::floor(localX + outerHalfWidth)));
+        if (outerFirst > outerLast) continue;
+
+        // Inner span is removed, the ring between inner and outer spans gets scorched;
+        // the bedrock rows at the bottom are only ever scorched so nothing falls through
+        std::int32_t innerFirst = outerLast + 1;
+        std::int32_t innerLast = outerLast;
+        if (std::abs(deltaY) <= radius && row < m_height - BEDROCK_ROWS) {
+            const float innerHalfWidth = std::sqrt(radius * radius - deltaY * deltaY);
+            innerFirst = std::max(outerFirst, static_cast<std::int32_t>(std::floor(localX - innerHalfWidth)));
+            innerLast = std::min(outerLast, static_cast<std::int32_t>(std::floor(localX + innerHalfWidth)));
+        }
+
+        Color* pixelRow = m_pixels.data() + static_cast<std::size_t>(row) * m_width;
+        for (std::int32_t column = outerFirst; column <= outerLast; ++column) {
+            const bool isInner = column >= innerFirst && column <= innerLast;
+            if (isInner) {
+                pixelRow[column].a = 0;
+            } else if (IsCellSolid(column, row)) {
+                Color& pixel = pixelRow[column];
+                pixel.r = static_cast<unsigned char>(pixel.r * SCORCH_DARKEN_FACTOR);
+                pixel.g = static_cast<unsigned char>(pixel.g * SCORCH_DARKEN_FACTOR);
+                pixel.b = static_cast<unsigned char>(pixel.b * SCORCH_DARKEN_FACTOR);
+            }
+        }
+
+        if (innerFirst <= innerLast) {
+            ClearRun(row, innerFirst, innerLast);
+        }
+
+        dirtyMinX = std::min(dirtyMinX, outerFirst);
+        dirtyMaxX = std::max(dirtyMaxX, outerLast);
+    }
+
+    if (dirtyMaxX >= dirtyMinX) {
+        MarkDirty(dirtyMinX, firstRow, dirtyMaxX, lastRow);
+    }
+}
+
+void TerrainMask::MarkDirty(std::int32_t minX, std::int32_t minY, std::int32_t maxX, std::int32_t maxY) noexcept {
+    if (!HasPendingUpload()) {
+        m_dirtyMinX = minX;
+        m_dirtyMinY = minY;
+        m_dirtyMaxX = maxX;
+        m_dirtyMaxY = maxY;
+        return;
+    }
+
+    m_dirtyMinX = std::min(m_dirtyMinX, minX);
+    m_dirtyMinY = std::min(m_dirtyMinY, minY);
+    m_dirtyMaxX = std::max(m_dirtyMaxX, maxX);
+    m_dirtyMaxY = std::max(m_dirtyMaxY, maxY);
+}
+
+void TerrainMask::ResetDirty() noexcept {
+    m_dirtyMinX = 0;
+    m_dirtyMinY = 0;
+    m_dirtyMaxX = -1;
+    m_dirtyMaxY = -1;
+}
+
+void TerrainMask::UploadDirtyRegion() {
+    if (!IsReady() || !HasPendingUpload()) return;
+
+    const std::int32_t regionWidth = m_dirtyMaxX - m_dirtyMinX + 1;
+    const std::int32_t regionHeight = m_dirtyMaxY - m_dirtyMinY + 1;
+
+    // UpdateTextureRec expects tightly packed rows, so gather the region first
+    m_uploadBuffer.resize(static_cast<std::size_t>(regionWidth) * regionHeight);
+    for (std::int32_t y = 0; y < regionHeight; ++y) {
+        const Color* source = m_pixels.data() + static_cast<std::size_t>(m_dirtyMinY + y) * m_width + m_dirtyMinX;
+        std::copy(source, source + regionWidth, m_uploadBuffer.data() + static_cast<std::size_t>(y) * regionWidth);
+    }
+
+    const Rectangle region = {
+        static_cast<float>(m_dirtyMinX), static_cast<float>(m_dirtyMinY),
+        static_cast<float>(regionWidth), static_cast<float>(regionHeight)
+    };
+    UpdateTextureRec(m_texture, region, m_uploadBuffer.data());
+
+    ResetDirty();
+}
+
+void TerrainMask::Draw(Color tint) const {
+    if (!IsReady()) return;
+
+    DrawTextureV(m_texture, Vector2{m_bounds.x, m_bounds.y}, tint);
+}
+
+std::optional<float> TerrainMask::FindSurfaceBelow(float x, float fromY, float toY) const noexcept {
+    const std::int32_t column = ToColumn(x);
+    if (column < 0 || column >= m_width) return std::nullopt;
+
+    const std::int32_t firstRow = std::max(0, ToRow(fromY));
+    const std::int32_t lastRow = std::min(m_height - 1, ToRow(toY));
+
+    for (std::int32_t row = firstRow; row <= lastRow; ++row) {
+        if (IsCellSolid(column, row)) {
+            return m_bounds.y + static_cast<float>(row);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<float> TerrainMask::FindCeilingAbove(float x, float fromY, float toY) const noexcept {
+    const std::int32_t column = ToColumn(x);
+    if (column < 0 || column >= m_width) return std::nullopt;
+
+    const std::int32_t firstRow = std::min(m_height - 1, ToRow(fromY));
+    const std::int32_t lastRow = std::max(0, ToRow(toY));
+
+    for (std::int32_t row = firstRow; row >= lastRow; --row) {
+        if (IsCellSolid(column, row)) {
+            return m_bounds.y + static_cast<float>(row + 1);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<float> TerrainMask::FindWall(float y, float fromX, float toX) const noexcept {
+    const std::int32_t row = ToRow(y);
+    if (row < 0 || row >= m_height) return std::nullopt;
+
+    if (toX >= fromX) {
+        const std::int32_t firstColumn = std::max(0, ToColumn(fromX));
+        const std::int32_t lastColumn = std::min(m_width - 1, ToColumn(toX));
+        for (std::int32_t column = firstColumn; column <= lastColumn; ++column) {
+            if (IsCellSolid(column, row)) {
+                return m_bounds.x + static_cast<float>(column);
+            }
+        }
+    } else {
+        const std::int32_t firstColumn = std::min(m_width - 1, ToColumn(fromX));
+        const std::int32_t lastColumn = std::max(0, ToColumn(toX));
+        for (std::int32_t column = firstColumn; column >= lastColumn; --column) {
+            if (IsCellSolid(column, row)) {
+                return m_bounds.x + static_cast<float>(column + 1);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace PlayAsGobo
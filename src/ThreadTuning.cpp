@@ -0,0 +1,335 @@
+#include "ThreadTuning.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #if defined(__linux__)
+        #include <sys/resource.h>
+        #include <sys/syscall.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+namespace PlayAsGobo {
+
+namespace {
+
+enum class ApplyStatus : std::uint8_t {
+    NotRequested,
+    Applied,
+    Denied,      // Needs privileges, e.g. CAP_SYS_NICE or an rtprio limit on Linux
+    Unsupported, // Not available on this platform
+    Failed
+};
+
+// Written by whichever thread applies a role, read by the report
+struct RoleResult {
+    std::atomic<bool> applied{false};
+    std::atomic<ApplyStatus> affinity{ApplyStatus::NotRequested};
+    std::atomic<ApplyStatus> priority{ApplyStatus::NotRequested};
+};
+
+constexpr int MIN_REALTIME_PRIORITY = 1;
+constexpr int MAX_REALTIME_PRIORITY = 99;
+constexpr int HIGH_PRIORITY_NICE = -5;
+constexpr std::size_t RESERVED_CORES = 2; // Game and audio threads
+
+ThreadSettings s_settings;
+std::array<RoleResult, THREAD_ROLE_COUNT> s_results;
+
+const char* GetRoleName(ThreadRole role) noexcept {
+    switch (role) {
+        case ThreadRole::Game:   return "game";
+        case ThreadRole::Audio:  return "audio";
+        case ThreadRole::Worker: return "worker";
+        case ThreadRole::Count:  break;
+    }
+    return "unknown";
+}
+
+const char* GetPriorityName(ThreadPriority priority) noexcept {
+    switch (priority) {
+        case ThreadPriority::Default:            return "default";
+        case ThreadPriority::High:               return "high";
+        case ThreadPriority::RealtimeFifo:       return "fifo";
+        case ThreadPriority::RealtimeRoundRobin: return "rr";
+    }
+    return "unknown";
+}
+
+const char* GetStatusName(ApplyStatus status) noexcept {
+    switch (status) {
+        case ApplyStatus::NotRequested: return "not applied";
+        case ApplyStatus::Applied:      return "applied";
+        case ApplyStatus::Denied:       return "denied, insufficient privileges";
+        case ApplyStatus::Unsupported:  return "unsupported on this platform";
+        case ApplyStatus::Failed:       return "failed";
+    }
+    return "unknown";
+}
+
+// "0,2-3" -> {0, 2, 3}
+bool ParseCpuList(const std::string& text, std::vector<int>& cpus) {
+    cpus.clear();
+    std::stringstream stream(text);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        int first = -1;
+        int last = -1;
+        char dash = 0;
+        std::istringstream parser(range);
+        if (!(parser >> first)) return false;
+        last = first;
+        if (parser >> dash) {
+            if (dash != '-' || !(parser >> last)) return false;
+        }
+        if (first < 0 || last < first) return false;
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return !cpus.empty();
+}
+
+bool ParsePriority(const std::string& text, ThreadPriority& priority) noexcept {
+    if (text == "default") priority = ThreadPriority::Default;
+    else if (text == "high") priority = ThreadPriority::High;
+    else if (text == "fifo") priority = ThreadPriority::RealtimeFifo;
+    else if (text == "rr") priority = ThreadPriority::RealtimeRoundRobin;
+    else return false;
+    return true;
+}
+
+std::string Trim(const std::string& text) {
+    const std::size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos) return {};
+    const std::size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+#if defined(_WIN32)
+ApplyStatus ToStatus(BOOL succeeded) noexcept {
+    if (succeeded) return ApplyStatus::Applied;
+    return GetLastError() == ERROR_ACCESS_DENIED ? ApplyStatus::Denied : ApplyStatus::Failed;
+}
+
+ApplyStatus ApplyAffinity(const std::vector<int>& cpus) noexcept {
+    DWORD_PTR mask = 0;
+    for (const int cpu : cpus) {
+        if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) mask |= DWORD_PTR{1} << cpu;
+    }
+    if (mask == 0) return ApplyStatus::Failed;
+    return ToStatus(SetThreadAffinityMask(GetCurrentThread(), mask) != 0);
+}
+
+ApplyStatus ApplyPriority(ThreadPriority priority, [[maybe_unused]] int realtimePriority) noexcept {
+    // Windows has no per-thread FIFO/RR; time-critical is the closest class
+    const int level = priority == ThreadPriority::High ? THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_TIME_CRITICAL;
+    return ToStatus(SetThreadPriority(GetCurrentThread(), level));
+}
+#else
+ApplyStatus ToStatus(int error) noexcept {
+    if (error == 0) return ApplyStatus::Applied;
+    return error == EPERM || error == EACCES ? ApplyStatus::Denied : ApplyStatus::Failed;
+}
+
+ApplyStatus ApplyAffinity([[maybe_unused]] const std::vector<int>& cpus) noexcept {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+    return ToStatus(pthread_setaffinity_np(pthread_self(), sizeof(set), &set));
+#else
+    // macOS only offers affinity hints through thread_policy_set, which it may ignore
+    return ApplyStatus::Unsupported;
+#endif
+}
+
+ApplyStatus ApplyPriority(ThreadPriority priority, int realtimePriority) noexcept {
+    if (priority == ThreadPriority::High) {
+#if defined(__linux__)
+        // Linux applies nice values per thread when given a thread id
+        const auto threadId = static_cast<id_t>(syscall(SYS_gettid));
+        return ToStatus(setpriority(PRIO_PROCESS, threadId, HIGH_PRIORITY_NICE) == 0 ? 0 : errno);
+#else
+        return ApplyStatus::Unsupported;
+#endif
+    }
+
+    const int policy = priority == ThreadPriority::RealtimeFifo ? SCHED_FIFO : SCHED_RR;
+    sched_param parameters{};
+    parameters.sched_priority = std::clamp(realtimePriority, sched_get_priority_min(policy),
+                                           sched_get_priority_max(policy));
+    return ToStatus(pthread_setschedparam(pthread_self(), policy, &parameters));
+}
+#endif
+
+} // namespace
+
+bool ThreadSettings::LoadFromFile(const std::string& path, ThreadSettings& settings) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        const std::size_t equals = line.find('=');
+        const std::size_t dot = line.find('.');
+        if (equals == std::string::npos || dot == std::string::npos || dot > equals) {
+            std::cerr << "Warning: " << path << ":" << lineNumber << ": expected <role>.<key> = <value>" << std::endl;
+            continue;
+        }
+
+        const std::string roleName = Trim(line.substr(0, dot));
+        const std::string key = Trim(line.substr(dot + 1, equals - dot - 1));
+        const std::string value = Trim(line.substr(equals + 1));
+
+        std::size_t roleIndex = 0;
+        while (roleIndex < THREAD_ROLE_COUNT && roleName != GetRoleName(static_cast<ThreadRole>(roleIndex))) {
+            ++roleIndex;
+        }
+        if (roleIndex == THREAD_ROLE_COUNT) {
+            std::cerr << "Warning: " << path << ":" << lineNumber << ": unknown thread role '" << roleName << "'" << std::endl;
+            continue;
+        }
+
+        ThreadRoleSettings& role = settings.roles[roleIndex];
+        bool isValid = true;
+        if (key == "cpus") {
+            std::vector<int> cpus;
+            isValid = ParseCpuList(value, cpus);
+            if (isValid) role.cpus = std::move(cpus);
+        } else if (key == "priority") {
+            isValid = ParsePriority(value, role.priority);
+        } else if (key == "realtime_priority") {
+            std::istringstream parser(value);
+            int priority = 0;
+            isValid = (parser >> priority) && priority >= MIN_REALTIME_PRIORITY && priority <= MAX_REALTIME_PRIORITY;
+            if (isValid) role.realtimePriority = priority;
+        } else if (key == "count" && roleIndex == static_cast<std::size_t>(ThreadRole::Worker)) {
+            std::istringstream parser(value);
+            std::size_t count = 0;
+            isValid = static_cast<bool>(parser >> count);
+            if (isValid) settings.workerCount = count;
+        } else {
+            std::cerr << "Warning: " << path << ":" << lineNumber << ": unknown key '" << roleName << "." << key << "'" << std::endl;
+            continue;
+        }
+
+        if (!isValid) {
+            std::cerr << "Warning: " << path << ":" << lineNumber << ": invalid value '" << value
+                      << "' for " << roleName << "." << key << std::endl;
+        }
+    }
+    return true;
+}
+
+std::size_t ThreadSettings::ResolveWorkerCount() const noexcept {
+    if (workerCount > 0) return workerCount;
+
+    const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > RESERVED_CORES ? hardwareThreads - RESERVED_CORES : 1;
+}
+
+namespace ThreadTuning {
+
+void Configure(const ThreadSettings& settings) {
+    s_settings = settings;
+}
+
+const ThreadSettings& GetSettings() noexcept {
+    return s_settings;
+}
+
+std::size_t GetWorkerCount() noexcept {
+    return s_settings.ResolveWorkerCount();
+}
+
+void ApplyToCurrentThread(ThreadRole role) noexcept {
+    const std::size_t index = static_cast<std::size_t>(role);
+    const ThreadRoleSettings& settings = s_settings.roles[index];
+    RoleResult& result = s_results[index];
+
+    if (!settings.cpus.empty()) {
+        result.affinity = ApplyAffinity(settings.cpus);
+    }
+    if (settings.priority != ThreadPriority::Default) {
+        result.priority = ApplyPriority(settings.priority, settings.realtimePriority);
+    }
+    result.applied.store(true, std::memory_order_release);
+}
+
+bool WaitUntilApplied(ThreadRole role, std::chrono::milliseconds timeout) noexcept {
+    const RoleResult& result = s_results[static_cast<std::size_t>(role)];
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!result.applied.load(std::memory_order_acquire)) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+bool IsRequested(ThreadRole role) noexcept {
+    const ThreadRoleSettings& settings = s_settings.roles[static_cast<std::size_t>(role)];
+    return !settings.cpus.empty() || settings.priority != ThreadPriority::Default;
+}
+
+void WriteReport(std::ostream& output) {
+    output << "Threads (" << std::thread::hardware_concurrency() << " hardware, "
+           << GetWorkerCount() << " worker):\n";
+
+    for (std::size_t index = 0; index < THREAD_ROLE_COUNT; ++index) {
+        const ThreadRole role = static_cast<ThreadRole>(index);
+        const ThreadRoleSettings& settings = s_settings.roles[index];
+        const RoleResult& result = s_results[index];
+
+        output << "  " << GetRoleName(role) << ": cpus ";
+        if (settings.cpus.empty()) {
+            output << "any";
+        } else {
+            for (std::size_t i = 0; i < settings.cpus.size(); ++i) {
+                output << (i > 0 ? "," : "") << settings.cpus[i];
+            }
+            output << " (" << GetStatusName(result.affinity) << ")";
+        }
+
+        output << ", priority " << GetPriorityName(settings.priority);
+        if (settings.priority == ThreadPriority::RealtimeFifo ||
+            settings.priority == ThreadPriority::RealtimeRoundRobin) {
+            output << " " << settings.realtimePriority;
+        }
+        if (settings.priority != ThreadPriority::Default) {
+            output << " (" << GetStatusName(result.priority) << ")";
+        }
+        if (IsRequested(role) && !result.applied.load(std::memory_order_acquire)) {
+            output << " [thread not started yet]";
+        }
+        output << "\n";
+    }
+    output.flush();
+}
+
+} // namespace ThreadTuning
+
+} // namespace PlayAsGobo
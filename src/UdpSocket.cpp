@@ -0,0 +1,126 @@
+#include "UdpSocket.hpp"
+#include <iostream>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <arpa/inet.h>
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace PlayAsGobo {
+
+namespace {
+
+#if defined(_WIN32)
+using NativeSocket = SOCKET;
+
+bool StartSockets() noexcept {
+    // Winsock is reference counted, so every socket takes and releases its own reference
+    WSADATA data;
+    return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+}
+
+void StopSockets() noexcept { WSACleanup(); }
+void CloseNative(NativeSocket handle) noexcept { closesocket(handle); }
+
+bool SetNonBlocking(NativeSocket handle) noexcept {
+    u_long enabled = 1;
+    return ioctlsocket(handle, FIONBIO, &enabled) == 0;
+}
+#else
+using NativeSocket = int;
+
+bool StartSockets() noexcept { return true; }
+void StopSockets() noexcept {}
+void CloseNative(NativeSocket handle) noexcept { close(handle); }
+
+bool SetNonBlocking(NativeSocket handle) noexcept {
+    const int flags = fcntl(handle, F_GETFL, 0);
+    return flags >= 0 && fcntl(handle, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+#endif
+
+sockaddr_in ToSockaddr(const UdpEndpoint& endpoint) noexcept {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(endpoint.address);
+    address.sin_port = htons(endpoint.port);
+    return address;
+}
+
+} // namespace
+
+UdpSocket::~UdpSocket() {
+    Close();
+}
+
+bool UdpSocket::Open(std::uint16_t port) {
+    Close();
+    if (!StartSockets()) {
+        std::cerr << "Warning: Could not initialize sockets" << std::endl;
+        return false;
+    }
+
+    const NativeSocket handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (static_cast<std::intptr_t>(handle) == INVALID_HANDLE) {
+        std::cerr << "Warning: Could not create UDP socket" << std::endl;
+        StopSockets();
+        return false;
+    }
+
+    const sockaddr_in address = ToSockaddr(Loopback(port));
+    if (bind(handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || !SetNonBlocking(handle)) {
+        std::cerr << "Warning: Could not bind UDP socket to 127.0.0.1:" << port << std::endl;
+        CloseNative(handle);
+        StopSockets();
+        return false;
+    }
+
+    m_handle = static_cast<std::intptr_t>(handle);
+    return true;
+}
+
+void UdpSocket::Close() noexcept {
+    if (m_handle == INVALID_HANDLE) return;
+
+    CloseNative(static_cast<NativeSocket>(m_handle));
+    StopSockets();
+    m_handle = INVALID_HANDLE;
+}
+
+bool UdpSocket::SendTo(const UdpEndpoint& endpoint, const void* data, std::size_t size) noexcept {
+    if (m_handle == INVALID_HANDLE) return false;
+
+    const sockaddr_in address = ToSockaddr(endpoint);
+    const auto sent = sendto(static_cast<NativeSocket>(m_handle), static_cast<const char*>(data),
+                             static_cast<int>(size), 0, reinterpret_cast<const sockaddr*>(&address),
+                             sizeof(address));
+    return sent >= 0 && static_cast<std::size_t>(sent) == size;
+}
+
+std::size_t UdpSocket::Receive(void* buffer, std::size_t capacity, UdpEndpoint& sender) noexcept {
+    if (m_handle == INVALID_HANDLE) return 0;
+
+    sockaddr_in address{};
+    socklen_t addressSize = sizeof(address);
+    const auto received = recvfrom(static_cast<NativeSocket>(m_handle), static_cast<char*>(buffer),
+                                   static_cast<int>(capacity), 0, reinterpret_cast<sockaddr*>(&address),
+                                   &addressSize);
+    if (received <= 0) return 0;
+
+    sender.address = ntohl(address.sin_addr.s_addr);
+    sender.port = ntohs(address.sin_port);
+    return static_cast<std::size_t>(received);
+}
+
+UdpEndpoint UdpSocket::Loopback(std::uint16_t port) noexcept {
+    return UdpEndpoint{INADDR_LOOPBACK, port};
+}
+
+} // namespace PlayAsGobo
@@ -1,9 +1,84 @@
 #include "Game.hpp"
+#include "SpectatorClient.hpp"
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <exception>
+#include <optional>
+#include <string>
 
-int main() {
+namespace {
+
+// Optional port argument; consumes it only when it parses
+std::uint16_t ParsePort(const char* text, int& index) {
+    if (text != nullptr) {
+        char* end = nullptr;
+        const unsigned long port = std::strtoul(text, &end, 10);
+        if (end != text && *end == '\0' && port > 0 && port <= 0xFFFF) {
+            ++index;
+            return static_cast<std::uint16_t>(port);
+        }
+    }
+    return PlayAsGobo::SpectatorProtocol::DEFAULT_PORT;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
     try {
+        std::string replayPath;
+        std::string stateHashLogPath;
+        bool runBenchmark = false;
+        std::optional<std::uint16_t> broadcastPort;
+        std::string threadConfigPath;
+        bool backgroundMusic = false;
+        bool gpuTimers = false;
+        for (int i = 1; i < argc; ++i) {
+            const std::string argument = argv[i];
+            if (argument == "--replay" && i + 1 < argc) {
+                replayPath = argv[++i];
+            } else if (argument == "--benchmark") {
+                runBenchmark = true;
+            } else if (argument == "--state-hash-log" && i + 1 < argc) {
+                stateHashLogPath = argv[++i];
+            } else if (argument == "--thread-config" && i + 1 < argc) {
+                threadConfigPath = argv[++i];
+            } else if (argument == "--gpu-timers") {
+                gpuTimers = true;
+            } else if (argument == "--background-music") {
+                backgroundMusic = true;
+            } else if (argument == "--broadcast") {
+                broadcastPort = ParsePort(i + 1 < argc ? argv[i + 1] : nullptr, i);
+            } else if (argument == "--spectate") {
+                // Viewer process, the game itself is never created
+                PlayAsGobo::SpectatorClient spectator;
+                return spectator.Run(ParsePort(i + 1 < argc ? argv[i + 1] : nullptr, i));
+            } else if (argument == "--compare-hashes" && i + 2 < argc) {
+                // Offline tool, no window needed
+                return PlayAsGobo::StateHashLog::Compare(argv[i + 1], argv[i + 2], std::cout);
+            } else {
+                std::cerr << "Usage: " << argv[0] << " [--replay <flight recorder dump>] [--benchmark]"
+                          << " [--state-hash-log <file>] [--compare-hashes <log a> <log b>]"
+                          << " [--broadcast [port]] [--spectate [port]] [--thread-config <file>]"
+                          << " [--background-music] [--gpu-timers]" << std::endl;
+                return -1;
+            }
+        }
+
+        // Threads read their settings as they start, so this comes before the game
+        PlayAsGobo::ThreadSettings threadSettings;
+        if (!threadConfigPath.empty()) {
+            if (!PlayAsGobo::ThreadSettings::LoadFromFile(threadConfigPath, threadSettings)) {
+                std::cerr << "Could not read thread config: " << threadConfigPath << std::endl;
+                return -1;
+            }
+        } else {
+            // Optional per-machine file next to the assets
+            [[maybe_unused]] const bool loaded = PlayAsGobo::ThreadSettings::LoadFromFile(
+                PlayAsGobo::ThreadTuning::DEFAULT_CONFIG_PATH, threadSettings);
+        }
+        PlayAsGobo::ThreadTuning::Configure(threadSettings);
+        
         PlayAsGobo::Game game;
         
         if (!game.IsInitialized()) {
@@ -11,6 +86,28 @@ int main() {
             return -1;
         }
         
+        game.SetBackgroundMusicEnabled(backgroundMusic);
+        
+        if (!stateHashLogPath.empty() && !game.EnableStateHashLog(stateHashLogPath)) {
+            return -1;
+        }
+        
+        if (broadcastPort && !game.EnableSpectatorServer(*broadcastPort)) {
+            return -1;
+        }
+        
+        if (gpuTimers && !game.EnableGpuTimers()) {
+            return -1;
+        }
+        
+        if (!replayPath.empty() && !game.StartReplay(replayPath)) {
+            return -1;
+        }
+        
+        if (runBenchmark) {
+            game.StartBenchmark(true);
+        }
+        
         game.Run();
         return 0;
         